@@ -0,0 +1,560 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : SpiLink.c                                                */
+/************************************************************************/
+
+// Every exchange carries one frame in each direction. A side with nothing
+// to send answers with an idle frame that still carries its ack. Data
+// frames stay in the transmit queue (in their pool PDU) until the peer
+// acknowledges them; when no ack progress is seen for
+// SpiLinkRetransmitTimeout SpiLink_MainFunction calls the whole window is
+// sent again.
+// The receiver only accepts the next expected sequence number and drops
+// anything else, so the sender's retransmission fills the gap.
+// Master: frames are clocked with Spi_SyncTransmit straight from the PDU.
+// Slave: frames are read from the DMA receive ring, the reply for the next
+// exchange is preloaded with Spi_SlaveSetReply, one per slave cycle. The
+// ring is a plain byte stream (a reset or a lost byte shifts every following frame), so a
+// rejected frame starts a hunt: the type byte is the start of frame marker
+// and the frame is realigned on the next candidate until one passes the CRC.
+
+#include "det.h"
+#include "BIT_MATH.h"
+#include "spi.h"
+#include "hw_reg.h"
+#include "SpiLink.h"
+
+/************************************************************************/
+/*                          Global Constants                            */
+/************************************************************************/
+#define SpiLink_ApiID_SpiLink_Transmit 0x01
+#define SpiLink_ApiID_SpiLink_Receive 0x02
+#define SpiLink_ApiID_SpiLink_FreePdu 0x03
+#define SpiLink_ApiID_SpiLink_MainFunction 0x04
+
+#define SPILINK_TYPE_IDX 0U
+#define SPILINK_SEQ_IDX 1U
+#define SPILINK_ACK_IDX 2U
+#define SPILINK_LEN_IDX 3U
+
+#define SPILINK_WORDS (SpiLinkFrameSize / 4U)
+
+// Header byte of a frame
+#define SPILINK_HDR(FramePtr, Idx) (((uint8 *)(FramePtr))[(Idx)])
+
+// Seq is before Ack in modulo 256 order
+#define SPILINK_SEQ_BEFORE(Seq, Ack) ((uint8)((uint8)((Ack) - (Seq)) - 1U) < 128U)
+
+// The slave acks once per cycle: an ack for a master cycle comes back at the
+// earliest in the reply clocked by the next one
+#if SpiLinkRetransmitTimeout < 2U
+#error "SpiLink: SpiLinkRetransmitTimeout shorter than the ack lag of the slave"
+#endif
+
+/************************************************************************/
+/*                          Local functions                             */
+/************************************************************************/
+static uint32 SpiLink_StaticCrc(const uint32 *FramePtr);
+static uint32 *SpiLink_StaticPrepareTx(void);
+static void SpiLink_StaticTxDone(const uint32 *FramePtr);
+static Std_ReturnType SpiLink_StaticProcessRx(uint32 *FramePtr);
+static uint32 *SpiLink_StaticRxBuffer(void);
+#ifndef SpiLinkRoleMaster
+static uint16 SpiLink_StaticResync(uint32 *FramePtr);
+static Std_ReturnType SpiLink_StaticSetReply(void);
+#endif
+
+/************************************************************************/
+/*                         Global variables                             */
+/************************************************************************/
+static boolean SpiLink_Initialized = FALSE;
+
+// PDU pool and its free stack
+static SpiLink_PduType SpiLink_Pool[SpiLinkPoolSize];
+static SpiLink_PduType *SpiLink_FreeStack[SpiLinkPoolSize];
+static uint8 SpiLink_FreeCount = 0;
+
+// Transmit queue: [Head, Head + Sent) in flight, [Head + Sent, Head + Count) waiting
+static SpiLink_PduType *SpiLink_TxQueue[SpiLinkPoolSize];
+static uint8 SpiLink_TxHead = 0;
+static uint8 SpiLink_TxCount = 0;
+static uint8 SpiLink_TxSent = 0;
+static uint8 SpiLink_TxNextSeq = 0;
+static uint8 SpiLink_TxTimer = 0;
+
+// Receive queue of delivered PDUs
+static SpiLink_PduType *SpiLink_RxQueue[SpiLinkRxQueueSize];
+static uint8 SpiLink_RxHead = 0;
+static uint8 SpiLink_RxCount = 0;
+static uint8 SpiLink_RxExpected = 0;
+
+// PDU receiving the next frame, NULL_PTR when the pool is empty
+static SpiLink_PduType *SpiLink_RxPdu = NULL_PTR;
+
+// Slave: bytes of the next frame already in the receive buffer (kept by a resync)
+static uint16 SpiLink_RxFill = 0;
+
+// Slave: reply prepared but not accepted by Spi_SlaveSetReply yet, NULL_PTR if none
+static const uint32 *SpiLink_ReplyPtr = NULL_PTR;
+
+// Idle frame and receive frame used when no PDU is available
+static uint32 SpiLink_IdleFrame[SPILINK_WORDS];
+static uint32 SpiLink_ScratchFrame[SPILINK_WORDS];
+
+static SpiLink_StatsType SpiLink_Stats;
+
+/************************************************************************/
+/*                         APIS definitions                             */
+/************************************************************************/
+/**
+ * @name : SpiLink_Init
+ * @param: NONE
+ * Non Reentrant
+ * Sync
+ * Fills the pool, resets sequence numbers and statistics.
+ * Slave: preloads the first reply (idle frame).
+ **/
+void SpiLink_Init(void)
+{
+    uint8 idx = 0;
+
+    for (idx = 0; idx < SpiLinkPoolSize; idx++)
+    {
+        SpiLink_FreeStack[idx] = &SpiLink_Pool[idx];
+    }
+    SpiLink_FreeCount = SpiLinkPoolSize;
+
+    SpiLink_TxHead = 0;
+    SpiLink_TxCount = 0;
+    SpiLink_TxSent = 0;
+    SpiLink_TxNextSeq = 0;
+    SpiLink_TxTimer = 0;
+    SpiLink_RxHead = 0;
+    SpiLink_RxCount = 0;
+    SpiLink_RxExpected = 0;
+    SpiLink_RxPdu = NULL_PTR;
+    SpiLink_RxFill = 0;
+    SpiLink_ReplyPtr = NULL_PTR;
+
+    SpiLink_Stats.TxFrames = 0;
+    SpiLink_Stats.TxDataFrames = 0;
+    SpiLink_Stats.Retransmissions = 0;
+    SpiLink_Stats.RxDataFrames = 0;
+    SpiLink_Stats.RxPayloadBytes = 0;
+    SpiLink_Stats.CrcErrors = 0;
+    SpiLink_Stats.RxDropped = 0;
+    SpiLink_Stats.Resyncs = 0;
+
+    for (idx = 0; idx < SPILINK_WORDS; idx++)
+    {
+        SpiLink_IdleFrame[idx] = 0;
+    }
+    SPILINK_HDR(SpiLink_IdleFrame, SPILINK_TYPE_IDX) = SPILINK_FRAME_IDLE;
+
+    SpiLink_Initialized = TRUE;
+
+#ifndef SpiLinkRoleMaster
+    SpiLink_ReplyPtr = SpiLink_StaticPrepareTx();
+    (void)SpiLink_StaticSetReply();
+#endif
+    return;
+}
+
+/**
+ * @name : SpiLink_AllocPdu
+ * @param: NONE
+ * Non Reentrant
+ * Sync
+ * @Return: Free PDU, NULL_PTR if the pool is empty
+ **/
+SpiLink_PduType *SpiLink_AllocPdu(void)
+{
+    SpiLink_PduType *PduPtr = NULL_PTR;
+
+    if (SpiLink_FreeCount != 0)
+    {
+        SpiLink_FreeCount--;
+        PduPtr = SpiLink_FreeStack[SpiLink_FreeCount];
+    }
+    return PduPtr;
+}
+
+/**
+ * @name : SpiLink_GetPayload
+ * @param: PduPtr: PDU from SpiLink_AllocPdu or SpiLink_Receive
+ * Reentrant
+ * Sync
+ * @Return: Payload area of the frame, SPILINK_MAX_PAYLOAD bytes
+ **/
+uint8 *SpiLink_GetPayload(SpiLink_PduType *PduPtr)
+{
+    return &SPILINK_HDR(PduPtr->Frame, SPILINK_HEADER_SIZE);
+}
+
+/**
+ * @name : SpiLink_Transmit
+ * @param: PduPtr: PDU with the payload written in place
+ *         Length: Payload length, 0 ~ SPILINK_MAX_PAYLOAD
+ * Non Reentrant, same task as SpiLink_MainFunction
+ * Sync
+ * @Return: E_OK: queued, the PDU goes back to the pool once acknowledged
+ *          E_NOT_OK: invalid parameters, the PDU stays with the caller
+ **/
+Std_ReturnType SpiLink_Transmit(SpiLink_PduType *PduPtr, uint8 Length)
+{
+#ifdef SpiLinkDevErrorDetect
+    if (SpiLink_Initialized == FALSE)
+    {
+        Det_ReportError(SPILINK_ModuleId, 0, SpiLink_ApiID_SpiLink_Transmit, SPILINK_E_UNINIT);
+        return E_NOT_OK;
+    }
+    if (PduPtr == NULL_PTR)
+    {
+        Det_ReportError(SPILINK_ModuleId, 0, SpiLink_ApiID_SpiLink_Transmit, SPILINK_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+    if (Length > SPILINK_MAX_PAYLOAD)
+    {
+        Det_ReportError(SPILINK_ModuleId, 0, SpiLink_ApiID_SpiLink_Transmit, SPILINK_E_PARAM_LENGTH);
+        return E_NOT_OK;
+    }
+#endif
+    // Every PDU comes from the pool, the queue can't overflow
+    SPILINK_HDR(PduPtr->Frame, SPILINK_TYPE_IDX) = SPILINK_FRAME_DATA;
+    SPILINK_HDR(PduPtr->Frame, SPILINK_SEQ_IDX) = SpiLink_TxNextSeq++;
+    SPILINK_HDR(PduPtr->Frame, SPILINK_LEN_IDX) = Length;
+
+    SpiLink_TxQueue[(SpiLink_TxHead + SpiLink_TxCount) % SpiLinkPoolSize] = PduPtr;
+    SpiLink_TxCount++;
+    return E_OK;
+}
+
+/**
+ * @name : SpiLink_Receive
+ * @param: LengthPtr: Payload length of the returned PDU
+ * Non Reentrant, same task as SpiLink_MainFunction
+ * Sync
+ * @Return: Oldest received PDU (payload by SpiLink_GetPayload), NULL_PTR if none.
+ *          Must be returned with SpiLink_FreePdu or reused for SpiLink_Transmit.
+ **/
+SpiLink_PduType *SpiLink_Receive(uint8 *LengthPtr)
+{
+    SpiLink_PduType *PduPtr = NULL_PTR;
+
+#ifdef SpiLinkDevErrorDetect
+    if (LengthPtr == NULL_PTR)
+    {
+        Det_ReportError(SPILINK_ModuleId, 0, SpiLink_ApiID_SpiLink_Receive, SPILINK_E_PARAM_POINTER);
+        return NULL_PTR;
+    }
+#endif
+    if (SpiLink_RxCount != 0)
+    {
+        PduPtr = SpiLink_RxQueue[SpiLink_RxHead];
+        SpiLink_RxHead = (uint8)((SpiLink_RxHead + 1U) % SpiLinkRxQueueSize);
+        SpiLink_RxCount--;
+        *LengthPtr = SPILINK_HDR(PduPtr->Frame, SPILINK_LEN_IDX);
+    }
+    return PduPtr;
+}
+
+/**
+ * @name : SpiLink_FreePdu
+ * @param: PduPtr: PDU to give back to the pool
+ * Non Reentrant, same task as SpiLink_MainFunction
+ * Sync
+ **/
+void SpiLink_FreePdu(SpiLink_PduType *PduPtr)
+{
+#ifdef SpiLinkDevErrorDetect
+    if (PduPtr == NULL_PTR || SpiLink_FreeCount >= SpiLinkPoolSize)
+    {
+        Det_ReportError(SPILINK_ModuleId, 0, SpiLink_ApiID_SpiLink_FreePdu, SPILINK_E_PARAM_POINTER);
+        return;
+    }
+#endif
+    SpiLink_FreeStack[SpiLink_FreeCount] = PduPtr;
+    SpiLink_FreeCount++;
+    return;
+}
+
+/**
+ * @name : SpiLink_GetStatistics
+ * @param: StatsPtr: Copy of the link counters
+ * Reentrant
+ * Sync
+ **/
+void SpiLink_GetStatistics(SpiLink_StatsType *StatsPtr)
+{
+    if (StatsPtr != NULL_PTR)
+    {
+        *StatsPtr = SpiLink_Stats;
+    }
+    return;
+}
+
+/**
+ * @name : SpiLink_MainFunction
+ * @param: NONE
+ * @Description: Master: exchanges up to SpiLinkFramesPerCycle frames. 
+ *               Slave: handles every complete frame received and preloads one 
+ *               reply acknowledging all of them.
+ **/
+void SpiLink_MainFunction(void)
+{
+    uint32 *TxFramePtr = NULL_PTR;
+    uint32 *RxFramePtr;
+    uint8 Frame = 0;
+#ifndef SpiLinkRoleMaster
+    boolean Received = FALSE;
+#endif
+
+    if (SpiLink_Initialized == FALSE)
+    {
+        return;
+    }
+
+    // Retransmit timer runs in calls, not in exchanges
+    if (SpiLink_TxSent != 0 && SpiLink_TxTimer < SpiLinkRetransmitTimeout)
+    {
+        SpiLink_TxTimer++;
+    }
+
+#ifdef SpiLinkRoleMaster
+    for (Frame = 0; Frame < SpiLinkFramesPerCycle; Frame++)
+    {
+        TxFramePtr = SpiLink_StaticPrepareTx();
+        RxFramePtr = SpiLink_StaticRxBuffer();
+
+        if (Spi_SetupEB(SpiLinkSpiChannel, (const uint8 *)TxFramePtr, (uint8 *)RxFramePtr, SpiLinkFrameSize) != E_OK ||
+            Spi_SyncTransmit(SpiLinkSpiSeq) != E_OK)
+        {
+            // Bus busy: nothing accounted, the same frame is prepared again next cycle
+            break;
+        }
+        SpiLink_StaticTxDone(TxFramePtr);
+        (void)SpiLink_StaticProcessRx(RxFramePtr);
+    }
+#else
+    (void)Frame;
+    (void)TxFramePtr;
+    // Every whole frame of the ring is handled, whatever the reply state
+    while (Spi_SlaveGetAvailable(SpiLinkSlaveUnit) >= (SpiLinkFrameSize - SpiLink_RxFill))
+    {
+        RxFramePtr = SpiLink_StaticRxBuffer();
+        (void)Spi_SlaveRead(SpiLinkSlaveUnit, (uint8 *)RxFramePtr + SpiLink_RxFill, SpiLinkFrameSize - SpiLink_RxFill);
+        SpiLink_RxFill = 0;
+        if (SpiLink_StaticProcessRx(RxFramePtr) != E_OK)
+        {
+            // Not on a frame boundary (or corrupted): realign, no reply for it
+            SpiLink_RxFill = SpiLink_StaticResync(RxFramePtr);
+            SpiLink_Stats.Resyncs++;
+            continue;
+        }
+        Received = TRUE;
+    }
+
+    // One reply per call, stamped after the loop so it carries the newest
+    // cumulative ack (a pending reply refused last call is stamped again)
+    if (Received == TRUE)
+    {
+        SpiLink_ReplyPtr = SpiLink_StaticPrepareTx();
+    }
+    (void)SpiLink_StaticSetReply();
+#endif
+    return;
+}
+
+/************************************************************************/
+/*                    Local functions Definitions                       */
+/************************************************************************/
+
+/**
+ * @name : SpiLink_StaticCrc
+ * @param: FramePtr: frame
+ * @Description: CRC-32 of every word of the frame except the last one, 
+ *               computed by the CRC unit.
+ **/
+static uint32 SpiLink_StaticCrc(const uint32 *FramePtr)
+{
+    uint8 idx = 0;
+
+    SET_BIT(CRC_CR, CRC_CR_RESET);
+    for (idx = 0; idx < (SPILINK_WORDS - 1U); idx++)
+    {
+        CRC_DR = FramePtr[idx];
+    }
+    return CRC_DR;
+}
+
+/**
+ * @name : SpiLink_StaticPrepareTx
+ * @param: NONE
+ * @Description: Selects the frame of the next exchange (next data frame of the 
+ *               window or the idle frame), stamps the current ack and the CRC. 
+ *               The window only moves in SpiLink_StaticTxDone, once the frame is 
+ *               handed to the bus, so a failed exchange prepares the same frame again.
+ **/
+static uint32 *SpiLink_StaticPrepareTx(void)
+{
+    uint32 *FramePtr = SpiLink_IdleFrame;
+
+    // No ack progress: send the whole window again
+    if (SpiLink_TxSent != 0 && SpiLink_TxTimer >= SpiLinkRetransmitTimeout)
+    {
+        SpiLink_TxSent = 0;
+        SpiLink_TxTimer = 0;
+        SpiLink_Stats.Retransmissions++;
+    }
+
+    if (SpiLink_TxSent < SpiLink_TxCount && SpiLink_TxSent < SpiLinkWindowSize)
+    {
+        FramePtr = SpiLink_TxQueue[(SpiLink_TxHead + SpiLink_TxSent) % SpiLinkPoolSize]->Frame;
+    }
+
+    SPILINK_HDR(FramePtr, SPILINK_ACK_IDX) = SpiLink_RxExpected;
+    FramePtr[SPILINK_WORDS - 1U] = SpiLink_StaticCrc(FramePtr);
+    return FramePtr;
+}
+
+/**
+ * @name : SpiLink_StaticTxDone
+ * @param: FramePtr: frame from SpiLink_StaticPrepareTx accepted by the bus
+ * @Description: Moves the window past a data frame.
+ **/
+static void SpiLink_StaticTxDone(const uint32 *FramePtr)
+{
+    if (FramePtr != SpiLink_IdleFrame)
+    {
+        SpiLink_TxSent++;
+        SpiLink_Stats.TxDataFrames++;
+    }
+    SpiLink_Stats.TxFrames++;
+    return;
+}
+
+/**
+ * @name : SpiLink_StaticRxBuffer
+ * @param: NONE
+ * @Description: Frame buffer for the next reception: a pool PDU so that a data 
+ *               frame is delivered without copy, the scratch frame if the pool is empty.
+ **/
+static uint32 *SpiLink_StaticRxBuffer(void)
+{
+    // Bytes kept by a resync stay in the buffer that holds them
+    if (SpiLink_RxPdu == NULL_PTR && SpiLink_RxFill == 0)
+    {
+        SpiLink_RxPdu = SpiLink_AllocPdu();
+    }
+    return (SpiLink_RxPdu != NULL_PTR) ? SpiLink_RxPdu->Frame : SpiLink_ScratchFrame;
+}
+
+/**
+ * @name : SpiLink_StaticProcessRx
+ * @param: FramePtr: received frame
+ * @Description: Checks the frame, releases the acknowledged PDUs and delivers 
+ *               the payload if it is the next expected data frame.
+ * @Return: E_NOT_OK if the frame is rejected on type, length or CRC
+ **/
+static Std_ReturnType SpiLink_StaticProcessRx(uint32 *FramePtr)
+{
+    uint8 Type = SPILINK_HDR(FramePtr, SPILINK_TYPE_IDX);
+    uint8 Ack = SPILINK_HDR(FramePtr, SPILINK_ACK_IDX);
+
+    if ((Type != SPILINK_FRAME_IDLE && Type != SPILINK_FRAME_DATA) ||
+        SPILINK_HDR(FramePtr, SPILINK_LEN_IDX) > SPILINK_MAX_PAYLOAD ||
+        FramePtr[SPILINK_WORDS - 1U] != SpiLink_StaticCrc(FramePtr))
+    {
+        SpiLink_Stats.CrcErrors++;
+        return E_NOT_OK;
+    }
+
+    // Cumulative ack: every queued frame before Ack was received by the peer
+    while (SpiLink_TxCount != 0 &&
+           SPILINK_SEQ_BEFORE(SPILINK_HDR(SpiLink_TxQueue[SpiLink_TxHead]->Frame, SPILINK_SEQ_IDX), Ack))
+    {
+        SpiLink_FreePdu(SpiLink_TxQueue[SpiLink_TxHead]);
+        SpiLink_TxHead = (uint8)((SpiLink_TxHead + 1U) % SpiLinkPoolSize);
+        SpiLink_TxCount--;
+        if (SpiLink_TxSent != 0)
+        {
+            SpiLink_TxSent--;
+        }
+        SpiLink_TxTimer = 0;
+    }
+
+    if (Type == SPILINK_FRAME_DATA)
+    {
+        if (SPILINK_HDR(FramePtr, SPILINK_SEQ_IDX) == SpiLink_RxExpected &&
+            SpiLink_RxPdu != NULL_PTR && FramePtr == SpiLink_RxPdu->Frame &&
+            SpiLink_RxCount < SpiLinkRxQueueSize)
+        {
+            SpiLink_RxQueue[(SpiLink_RxHead + SpiLink_RxCount) % SpiLinkRxQueueSize] = SpiLink_RxPdu;
+            SpiLink_RxCount++;
+            SpiLink_RxPdu = NULL_PTR;
+            SpiLink_RxExpected++;
+            SpiLink_Stats.RxDataFrames++;
+            SpiLink_Stats.RxPayloadBytes += SPILINK_HDR(FramePtr, SPILINK_LEN_IDX);
+        }
+        else
+        {
+            // Duplicate, out of order or no room: not acknowledged, the peer sends it again
+            SpiLink_Stats.RxDropped++;
+        }
+    }
+    return E_OK;
+}
+
+#ifndef SpiLinkRoleMaster
+/**
+ * @name : SpiLink_StaticResync
+ * @param: FramePtr: rejected frame
+ * @Description: Frame hunting on the slave. The bytes from the next start of frame 
+ *               candidate (type byte) on are moved to the start of the buffer, the 
+ *               rest of the frame is read from the ring. A false candidate is 
+ *               rejected again and the hunt moves to the following one, so the 
+ *               slave locks on the master's frames within a few exchanges.
+ * @Return: Number of bytes kept, 0 if the frame holds no candidate
+ **/
+static uint16 SpiLink_StaticResync(uint32 *FramePtr)
+{
+    uint8 *BytePtr = (uint8 *)FramePtr;
+    uint16 Start = 1;
+    uint16 idx = 0;
+
+    while (Start < SpiLinkFrameSize &&
+           BytePtr[Start] != SPILINK_FRAME_IDLE && BytePtr[Start] != SPILINK_FRAME_DATA)
+    {
+        Start++;
+    }
+    for (idx = 0; (Start + idx) < SpiLinkFrameSize; idx++)
+    {
+        BytePtr[idx] = BytePtr[Start + idx];
+    }
+    return (uint16)(SpiLinkFrameSize - Start);
+}
+
+/**
+ * @name : SpiLink_StaticSetReply
+ * @param: NONE
+ * @Description: Queues the pending reply. Spi_SlaveSetReply refuses it while the 
+ *               previous reply is still being clocked out; the reply then stays 
+ *               pending (window not moved) and is queued on a later call.
+ * @Return: E_OK: no reply pending anymore
+ **/
+static Std_ReturnType SpiLink_StaticSetReply(void)
+{
+    if (SpiLink_ReplyPtr != NULL_PTR)
+    {
+        if (Spi_SlaveSetReply(SpiLinkSlaveUnit, (const uint8 *)SpiLink_ReplyPtr, SpiLinkFrameSize) != E_OK)
+        {
+            return E_NOT_OK;
+        }
+        SpiLink_StaticTxDone(SpiLink_ReplyPtr);
+        SpiLink_ReplyPtr = NULL_PTR;
+    }
+    return E_OK;
+}
+#endif
@@ -0,0 +1,95 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : SpiLink.h                                                */
+/* Note      : Framed link between two MCUs over SPI.                   */
+/*             Fixed size frames, sequence numbers, cumulative ack,     */
+/*             go-back-N retransmission, CRC-32 by the CRC unit.        */
+/*             The CRC unit clock has to be enabled (RCC_AHBENR.CRCEN). */
+/************************************************************************/
+
+#ifndef SPILINK_H
+#define SPILINK_H
+
+#include "STD_TYPES.h"
+#include "SpiLink_Cfg.h"
+
+/************************************************************************/
+/*                          Published Info                              */
+/************************************************************************/
+
+#define SPILINK_ModuleId                (203U)
+#define SPILINK_VendorId                (483U)
+
+#define SPILINK_SW_MAJOR_VERSION        (1U)
+#define SPILINK_SW_MINOR_VERSION        (0U)
+#define SPILINK_SW_PATCH_VERSION        (0U)
+
+/************************************************************************/
+/*                                DET                                   */
+/************************************************************************/
+#define SPILINK_E_PARAM_POINTER         0x01
+#define SPILINK_E_PARAM_LENGTH          0x02
+#define SPILINK_E_UNINIT                0x05
+
+/************************************************************************/
+/*                         Module Constants                             */
+/************************************************************************/
+
+/* Frame layout
+    [0] type (start of frame marker for the slave)   [1] seq   [2] ack (next seq expected from the peer)   [3] payload length
+    [4 ~ SpiLinkFrameSize - 5] payload
+    last word: CRC-32 of the words before it
+*/
+#define SPILINK_HEADER_SIZE             4U
+#define SPILINK_CRC_SIZE                4U
+#define SPILINK_MAX_PAYLOAD             (SpiLinkFrameSize - SPILINK_HEADER_SIZE - SPILINK_CRC_SIZE)
+
+#define SPILINK_FRAME_IDLE              0xA0U   // ack only
+#define SPILINK_FRAME_DATA              0xA1U
+
+/************************************************************************/
+/*                            Type Definitons                           */
+/************************************************************************/
+
+/* Pool buffer holding one frame. The producer writes the payload in place 
+   (SpiLink_GetPayload), the frame is sent from the same buffer. */
+typedef struct
+{
+    uint32 Frame[SpiLinkFrameSize / 4U];
+}SpiLink_PduType;
+
+typedef struct
+{
+    uint32 TxFrames;                // Frames exchanged
+    uint32 TxDataFrames;            // Data frames sent, retransmissions included
+    uint32 Retransmissions;         // Window restarts after a timeout
+    uint32 RxDataFrames;            // Data frames delivered
+    uint32 RxPayloadBytes;          // Goodput
+    uint32 CrcErrors;               // Frames dropped on CRC or type
+    uint32 RxDropped;               // Valid frames dropped (out of order or no buffer)
+    uint32 Resyncs;                 // Slave: realignments on a start of frame after a rejected frame
+}SpiLink_StatsType;
+
+/************************************************************************/
+/*                      Functions Declaration                           */
+/************************************************************************/
+
+void SpiLink_Init( void );
+
+SpiLink_PduType* SpiLink_AllocPdu( void );
+
+uint8* SpiLink_GetPayload( SpiLink_PduType* PduPtr );
+
+Std_ReturnType SpiLink_Transmit( SpiLink_PduType* PduPtr, uint8 Length );
+
+SpiLink_PduType* SpiLink_Receive( uint8* LengthPtr );
+
+void SpiLink_FreePdu( SpiLink_PduType* PduPtr );
+
+void SpiLink_GetStatistics( SpiLink_StatsType* StatsPtr );
+
+void SpiLink_MainFunction( void );
+
+#endif // EOF
@@ -0,0 +1,57 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : SpiLink_Cfg.h                                            */
+/************************************************************************/
+
+#ifndef SPILINK_CFG_H
+#define SPILINK_CFG_H
+
+// SpiLink General Container
+
+// Switches the development error detection and notification on or off.
+#define SpiLinkDevErrorDetect
+
+/*  Role of this MCU on the link
+    defined  : master, clocks the frames with Spi_SyncTransmit
+    undefined: slave, SPI unit in SPI_SLAVE_MODE (SpiSlaveSupport)
+*/
+#define SpiLinkRoleMaster
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Frame size in bytes: 4 header + payload + 4 CRC
+// Multiple of 4, not more than SpiEbMaxLength, same value on both MCUs
+#define SpiLinkFrameSize                64U
+
+// Number of PDUs (frame buffers) shared by transmit and receive
+#define SpiLinkPoolSize                 8U
+
+// Data frames sent and not acknowledged yet (< 128)
+#define SpiLinkWindowSize               4U
+
+// Received PDUs waiting for SpiLink_Receive
+#define SpiLinkRxQueueSize              4U
+
+// SpiLink_MainFunction calls without acknowledgement progress before the window is sent again
+// At least 2: the slave acks once per cycle, in the reply to the master's next cycle
+#define SpiLinkRetransmitTimeout        4U
+
+// Master: frames exchanged per SpiLink_MainFunction call
+#define SpiLinkFramesPerCycle           4U
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Spi binding
+
+// Master: EB channel, 8 bit, full duplex, SpiLinkFrameSize elements
+#define SpiLinkSpiChannel               9U
+
+// Master: sequence holding one job [SpiLinkSpiChannel]
+#define SpiLinkSpiSeq                   9U
+
+// Slave: HW unit configured in SPI_SLAVE_MODE, ring of at least 2 frames
+#define SpiLinkSlaveUnit                SPI2_HW_UNIT
+
+#endif
@@ -5,8 +5,9 @@
 /* File      : spi.c                                                    */
 /************************************************************************/
 
-// The SPI Handler/Driver handles only the Master mode
-// The SPI Handler/Driver only supports full-duplex mode.
+// Jobs and sequences are handled on Master units only.
+// Slave units receive by DMA into a ring, see Spi_SlaveXxx APIs (SpiSlaveSupport).
+// Channels run full-duplex, RX only or 3-wire half-duplex (SpiChannelDirection).
 
 #include "det.h"
 #include "BIT_MATH.h"
@@ -33,12 +34,26 @@
 #define Spi_ApiID_Spi_Cancel
 #define Spi_ApiID_Spi_SetAsyncMode
 #define Spi_ApiID_Spi_MainFunction_Handling
+#define Spi_ApiID_Spi_SlaveGetAvailable 0x20
+#define Spi_ApiID_Spi_SlaveRead 0x21
+#define Spi_ApiID_Spi_SlaveConsume 0x22
+#define Spi_ApiID_Spi_SlaveSetReply 0x23
+#define Spi_ApiID_Spi_SlaveGetOverrunCount 0x24
+#define Spi_ApiID_Spi_CalibrateBaudRate 0x25
+#define Spi_ApiID_Spi_RunProgram 0x26
 
 #define PORTA_CHANNEL_OFFEST (0U)
 #define PORTB_CHANNEL_OFFEST (16U)
 #define PORTC_CHANNEL_OFFEST (32U)
 #define PORTx_CHANNEL_OFFSET (48U)
 
+#ifdef SpiCsDecoderSupport
+// Address and enable lines resolved at compile time: CS assertion is plain stores
+#define SPI_CS_DECODER_BSRR     *((volatile uint32 *)(GPIOA_BASE + ((uint32)SpiCsDecoderPort * GPIO_PORT_STRIDE) + GPIO_BSRR_OFFSET))
+#define SPI_CS_DECODER_EN_BSRR  *((volatile uint32 *)(GPIOA_BASE + ((uint32)(SpiCsDecoderEnableChannel >> 4) * GPIO_PORT_STRIDE) + GPIO_BSRR_OFFSET))
+#define SPI_CS_DECODER_EN_PIN   (SpiCsDecoderEnableChannel & 0x0FU)
+#endif
+
 /************************************************************************/
 /*                          Type Definition                             */
 /************************************************************************/
@@ -46,19 +61,75 @@ typedef struct TransmitionType
 {
     volatile uint32 *SPI_DR;
     volatile uint32 *SPI_SR;
+    volatile uint32 *SPI_CR1;
     const Spi_DataBufferType *Srcdata;
     Spi_DataBufferType *Desdata;
     Spi_NumberOfDataType Length;
+    Spi_DataBufferType DefaultData;     // Sent when Srcdata is NULL_PTR
+    Spi_DffType DataWidth;              // 16 bit: buffers hold one uint16 per frame
+    uint32 SckCycles;                   // Core cycles per SCK, times the RX only stop sequence
+    SpiTransferStartType TransferStart; // Byte order of packed frames
 
 } TransmitionType;
 
+#ifdef SpiSlaveSupport
+/* Run time data of a slave HW unit
+   Bytes received = RxLaps * ring size + write index of the DMA.
+   Counters are free running, ring index = counter % ring size.
+*/
+typedef struct
+{
+    const Spi_SlaveConfigType *ConfigPtr;
+    volatile uint32 *SPI_DR;
+    volatile uint32 RxLaps;             // Passes of the RX DMA over the ring, counted by the TC interrupt
+    uint32 RxConsumed;                  // Bytes consumed by the user since init
+    uint32 OverrunCount;                // Bytes overwritten by the DMA before being consumed
+    uint8 RxDmaChannel;
+    uint8 TxDmaChannel;
+} Spi_SlaveUnitType;
+#endif
+
 /************************************************************************/
 /*                          Local functions                             */
 /************************************************************************/
 static void SPI_StaticStartTransmission(TransmitionType TransmitStrcut);
+static void SPI_StaticStartTransmitOnly(TransmitionType TransmitStrcut);
+static void SPI_StaticStartPackedTransmission(TransmitionType TransmitStrcut);
+static void SPI_StaticStartReceiveOnly(TransmitionType TransmitStrcut);
+static void Spi_StaticWaitCycles(uint32 Cycles);
 static void Spi_StaticHandleJob(Spi_JobType SpiJobId);
+static void Spi_StaticSetupUnit(Spi_JobType SpiJobId, volatile TransmitionType *TransmitPtr);
+static void Spi_StaticCsAssert(Spi_JobType SpiJobId, volatile uint32 *SPI_CR1);
+static void Spi_StaticCsRelease(Spi_JobType SpiJobId, volatile uint32 *SPI_CR1);
+#ifdef SpiTransferProgramApi
+static uint8 Spi_StaticExchange(volatile TransmitionType *TransmitPtr, uint8 TxData);
+static uint16 Spi_StaticOperandBytes(const uint8 *ProgramPtr, uint16 Pc, uint16 ProgramLength, uint8 OpCode);
+static uint16 Spi_StaticSkipLoop(const uint8 *ProgramPtr, uint16 Pc, uint16 ProgramLength);
+#endif
 static void Spi_StaticInitHWUnits(void);
+#if SpiChannelBuffersAllowed == SpiChannelBufferIB || SpiChannelBuffersAllowed == SpiChannelBufferIB_EB
+static void Spi_StaticWriteIB(Spi_ChannelType Channel, const Spi_DataBufferType *DataBufferPtr);
+#ifdef SpiDevErrorDetect
+static Std_ReturnType Spi_StaticCheckIBConfig(const Spi_ConfigType *ConfigPtr);
+#endif
+#endif
 static void Dio_WriteChannel(Spi_CS_Pin ChannelId, Std_ReturnType Level);
+static Spi_ModeType Spi_StaticGetUnitMode(Spi_HWunitType HWUnit);
+#ifdef SpiBaudCalibrationApi
+static uint8 Spi_StaticCountBitErrors(const Spi_DataBufferType *ReceivedPtr, const Spi_DataBufferType *ExpectedPtr, Spi_NumberOfDataType Length);
+#endif
+#ifdef SpiSlaveSupport
+static void Spi_StaticInitSlave(Spi_SlaveUnitType *UnitPtr, const Spi_SlaveConfigType *SlaveConfigPtr,
+                                volatile uint32 *SPI_CR1, volatile uint32 *SPI_CR2, volatile uint32 *SPI_DR,
+                                uint8 RxDmaChannel, uint8 TxDmaChannel);
+static Spi_SlaveUnitType *Spi_StaticGetSlaveUnit(Spi_HWunitType HWUnit, uint8 ApiId);
+#ifdef SpiDevErrorDetect
+static uint8 Spi_StaticCheckSlaveConfig(Spi_ModeType Mode, const Spi_SlaveConfigType *SlaveConfigPtr);
+#endif
+static Spi_NumberOfDataType Spi_StaticSlaveAvailable(Spi_SlaveUnitType *UnitPtr);
+static void Spi_StaticSlaveRxIsr(Spi_SlaveUnitType *UnitPtr);
+static void Spi_StaticSlaveTxIsr(Spi_SlaveUnitType *UnitPtr);
+#endif
 
 /************************************************************************/
 /*                         Global variables                             */
@@ -78,8 +149,17 @@ static Spi_JobResultType Spi_JobResult[SpiMaxJob];
 // Array to hold all Sequences' results
 static Spi_SeqResultType Spi_SequenceResult[SpiMaxSequence];
 
-// Internal Data buffer array
-static Spi_DataBufferType Spi_IB[SpiMaxChannel][SpiIbNBuffers];
+// Baud rate used by each job, copied from the configuration, updated by Spi_CalibrateBaudRate
+static Spi_BaudRateType Spi_JobBaudRate[SpiMaxJob];
+
+/* Internal Data buffer array: one half-word slot per element so that 16 bit
+   channels fit, 8 bit channels use the first NoOfDataElements bytes of their row */
+static uint16 Spi_IB[SpiMaxChannel][SpiIbNBuffers];
+
+#define SPI_IB_BUFFER(Channel) ((Spi_DataBufferType *)Spi_IB[(Channel)])
+// Bytes of IB channel data: 2 per element for 16 bit channels
+#define SPI_IB_BYTES(Channel) (Spi_ConfigPtr->Spi_ChannelConfigPtr[(Channel)].NoOfDataElements * \
+                               ((Spi_ConfigPtr->Spi_ChannelConfigPtr[(Channel)].SpiDataWidth == SPI_DFF_MODE_16Bit) ? 2U : 1U))
 
 // External Data Buffer pointers
 static struct Spi_EB
@@ -90,6 +170,11 @@ static struct Spi_EB
 };
 
 static struct Spi_EB Spi_EBInstance[SpiMaxChannel];
+
+#ifdef SpiSlaveSupport
+// Index 0: SPI1, Index 1: SPI2
+static Spi_SlaveUnitType Spi_SlaveUnit[2];
+#endif
 /************************************************************************/
 /*                         APIS definitions                             */
 /************************************************************************/
@@ -106,10 +191,36 @@ void Spi_Init(const Spi_ConfigType *ConfigPtr)
 {
 
 #ifdef SpiDevErrorDetect
+#ifdef SpiSlaveSupport
+    uint8 SlaveError = 0;
+
+    if (ConfigPtr != NULL_PTR)
+    {
+        SlaveError = Spi_StaticCheckSlaveConfig(ConfigPtr->Spi1Mode, ConfigPtr->Spi1SlaveConfigPtr);
+        if (SlaveError == 0U)
+        {
+            SlaveError = Spi_StaticCheckSlaveConfig(ConfigPtr->Spi2Mode, ConfigPtr->Spi2SlaveConfigPtr);
+        }
+    }
+#endif
     if (ConfigPtr == NULL_PTR)
     {
         Det_ReportError(SPI_ModuleId, 0x00, Spi_ApiID_Spi_Init, SPI_E_PARAM_POINTER);
     }
+#ifdef SpiSlaveSupport
+    else if (SlaveError != 0U)
+    {
+        // Slave unit without a usable receive ring
+        Det_ReportError(SPI_ModuleId, 0x00, Spi_ApiID_Spi_Init, SlaveError);
+    }
+#endif
+#if (SpiChannelBuffersAllowed == SpiChannelBufferIB || SpiChannelBuffersAllowed == SpiChannelBufferIB_EB)
+    else if (Spi_StaticCheckIBConfig(ConfigPtr) != E_OK)
+    {
+        // IB channel with more elements than its row holds
+        Det_ReportError(SPI_ModuleId, 0x00, Spi_ApiID_Spi_Init, SPI_E_PARAM_LENGTH);
+    }
+#endif
     else
     {
         // ok proceed
@@ -122,6 +233,10 @@ void Spi_Init(const Spi_ConfigType *ConfigPtr)
 
         // Initialize HW units
         Spi_StaticInitHWUnits();
+
+        // Cycle counter timing the receive only stop sequence
+        SET_BIT(DEMCR, DEMCR_TRCENA);
+        SET_BIT(DWT_CTRL, DWT_CTRL_CYCCNTENA);
         Spi1_Status = SPI_IDLE;
         Spi2_Status = SPI_IDLE;
 
@@ -131,6 +246,12 @@ void Spi_Init(const Spi_ConfigType *ConfigPtr)
             Spi_JobResult[JobIdx] = SPI_JOB_OK;
         }
 
+        // Initialize jobs baud rate
+        for (JobIdx = 0; JobIdx < ConfigPtr->NoOfJobs && JobIdx < SpiMaxJob; JobIdx++)
+        {
+            Spi_JobBaudRate[JobIdx] = ConfigPtr->Spi_JobConfigPtr[JobIdx].SpiBaudRate;
+        }
+
         // Initialize all sequences status
         for (SeqIdx = 0; SeqIdx < SpiMaxSequence; SeqIdx++)
         {
@@ -164,7 +285,8 @@ void Spi_Init(const Spi_ConfigType *ConfigPtr)
 /**
     * @name : Spi_WriteIB
 	* @param: Channel: Channel ID.
-	* 		DataBufferPtr: Pointer to source data buffer.
+	* 		DataBufferPtr: Pointer to source data buffer, NoOfDataElements elements
+	* 		               (half-word aligned uint16 elements for 16 bit channels).
 	* Note: If this pointer is null, default transmit value of this channel will be used instead.
     * Reentrancy: Reentrant
     * @Return:  Std_ReturnType:
@@ -176,7 +298,6 @@ void Spi_Init(const Spi_ConfigType *ConfigPtr)
 Std_ReturnType Spi_WriteIB(Spi_ChannelType Channel, const Spi_DataBufferType *DataBufferPtr)
 {
     Std_ReturnType retStatus = E_OK;
-    uint8 BufferIdx = 0;
 #ifdef SpiDevErrorDetect
     // Check if module is initialized
     // Channel is valid
@@ -194,25 +315,10 @@ Std_ReturnType Spi_WriteIB(Spi_ChannelType Channel, const Spi_DataBufferType *Da
     }
     else
     {
-        if (DataBufferPtr == NULL_PTR)
-        {
-            // Channel should transmit the default value
-        }
-        else
-        {
-            // Store data in internal buffer
-            for (BufferIdx = 0; BufferIdx < Spi_ConfigPtr->Spi_ChannelConfigPtr[Channel].NoOfDataElements; BufferIdx++)
-            {
-                Spi_IB[Channel][BufferIdx] = (DataBufferPtr[BufferIdx]);
-            }
-        }
+        Spi_StaticWriteIB(Channel, DataBufferPtr);
     }
 #else
-    // Store data in internal buffer
-    for (BufferIdx = 0; BufferIdx < Spi_ConfigPtr->Spi_ChannelConfigPtr[Channel].NoOfDataElements; BufferIdx++)
-    {
-        Spi_IB[Channel][BufferIdx] = (DataBufferPtr[BufferIdx]);
-    }
+    Spi_StaticWriteIB(Channel, DataBufferPtr);
 #endif
 
     return retStatus;
@@ -224,7 +330,8 @@ Std_ReturnType Spi_WriteIB(Spi_ChannelType Channel, const Spi_DataBufferType *Da
 /**
 * @name : Spi_ReadIB
 * @param: Channel: Channel ID.
-* 			 DataBufferPtr: Pointer to source data buffer.
+* 			 DataBufferPtr: Pointer to destination data buffer, NoOfDataElements elements
+* 			                (half-word aligned uint16 elements for 16 bit channels).
 * @Reentrancy: Reentrant
 * @Return:  Std_ReturnType:
 *          E_OK: Write command has been accepted 
@@ -254,9 +361,10 @@ Std_ReturnType Spi_ReadIB(Spi_ChannelType Channel, Spi_DataBufferType *DataBuffe
     }
     else
     {
-			uint8 idx = 0 ;
-			for (idx =0; idx< Spi_ConfigPtr->Spi_ChannelConfigPtr[Channel].NoOfDataElements  ; idx++)
-				{	DataBufferPointer[idx] = Spi_IB[Channel][idx]; }
+			uint16 idx = 0 ;
+			// 16 bit channels: 2 bytes per element
+			for (idx =0; idx< SPI_IB_BYTES(Channel)  ; idx++)
+				{	DataBufferPointer[idx] = SPI_IB_BUFFER(Channel)[idx]; }
     }
 #else
 
@@ -399,6 +507,14 @@ Std_ReturnType Spi_SyncTransmit(Spi_SequenceType Sequence)
 
               //  Spi_CurrentJobPtr = Spi_ConfigPtr->Spi_JobConfigPtr[Spi_CurrentJob];
 
+                // Jobs can't be handled on slave or unused units
+                if (Spi_StaticGetUnitMode(Spi_ConfigPtr->Spi_JobConfigPtr[Spi_CurrentJob].SpiHwUnit) != SPI_MASTER_MODE)
+                {
+                    Spi_JobResult[Spi_ConfigPtr->Spi_JobConfigPtr[Spi_CurrentJob].SpiJobId] = SPI_JOB_FAILED;
+                    ret = E_NOT_OK;
+                    break;
+                }
+
                 // Check which HW unit the job is assigned to and perform Sync send operation.
                 if (Spi_ConfigPtr->Spi_JobConfigPtr[Spi_CurrentJob].SpiHwUnit == SPI1_HW_UNIT)
                 {
@@ -443,7 +559,7 @@ Std_ReturnType Spi_SyncTransmit(Spi_SequenceType Sequence)
                 }
             }
             // Update Sequence Status
-            Spi_SequenceResult[Sequence] = SPI_SEQ_OK;
+            Spi_SequenceResult[Sequence] = (ret == E_OK) ? SPI_SEQ_OK : SPI_SEQ_FAILED;
         }
     }
 #else
@@ -551,228 +667,1158 @@ void Spi_GetVersionInfo(Std_VersionInfoType *VersionInfo)
     return;
 }
 #endif
-/************************************************************************/
-/*                    Local functions Definitions                       */
-/************************************************************************/
-
-/**
-* @name : SPI_StaticStartTransmission
-* @param: HW_Unit: Associated HW unit 
-* 			  Srcdata: source data buffer 
-* 			  Destdata: destination data buffer
-*					Length: Length of data buffer
-* @Description: local function to start transmition of array of data and store the result.
-**/
-static void SPI_StaticStartTransmission(TransmitionType TransmitStrcut)
-{
-    uint16 idx = 0;
-
-    // Send Data
-    for (idx = 0; idx < TransmitStrcut.Length; idx++)
-    {
-        *(TransmitStrcut.SPI_DR) = TransmitStrcut.Srcdata[idx];
-        // *(TransmitStrcut.SPI_DR) = *((const uint32 *)((TransmitStrcut.Srcdata) + idx));
-        // Wait for Busy Flag
-        while (GET_BIT(*(TransmitStrcut.SPI_SR), SPI_SR_BSY) != 0)
-            ;
-     //   TransmitStrcut.Desdata[idx] = (((*TransmitStrcut.SPI_DR) >> 24) & 0xFF);
-    }
-    return;
-}
-
+#ifdef SpiBaudCalibrationApi
 /**
-* @name : Spi_StaticHandleJob
-* @param: SpiJobId : Job ID
-* @Description: Handle Job transmition
+    * @name : Spi_CalibrateBaudRate
+    * @param: Sequence: Sequence addressing the device, all its jobs get the selected rate
+    *         Channel: EB channel of the sequence carrying the test pattern
+    *         PatternPtr: Pattern sent on Channel (known pattern or echo register write/read)
+    *         ExpectedPtr: Data expected back on Channel, NULL_PTR: the pattern itself (loopback)
+    *         Length: Pattern length, 1 ~ SpiCalibrationMaxLength
+    *         Repetitions: Transfers per prescaler
+    *         SelectedPtr: Selected prescaler (SPI_BAUD_RATE_CLK_DIVx), written on E_OK only,
+    *                      may be NULL_PTR
+    * Reentrancy: Non Reentrant
+    * @Return:  E_OK: Rate selected and applied
+    *           E_NOT_OK: Errors even at SPI_BAUD_RATE_CLK_DIV256 or bus not available, 
+    *                     each job gets its own previous rate back
+    * Sync
+    * @Description: Steps from the slowest prescaler to the fastest and counts the bit errors 
+    *               of each setting. The fastest setting reached without any error, made 
+    *               SpiCalibrationMarginSteps slower, is kept for the jobs of the sequence.
 **/
-static void Spi_StaticHandleJob(Spi_JobType SpiJobId)
+Std_ReturnType Spi_CalibrateBaudRate(Spi_SequenceType Sequence, Spi_ChannelType Channel,
+                                     const Spi_DataBufferType *PatternPtr, const Spi_DataBufferType *ExpectedPtr,
+                                     Spi_NumberOfDataType Length, uint8 Repetitions, Spi_BaudRateType *SelectedPtr)
 {
+    static Spi_DataBufferType RxBuffer[SpiCalibrationMaxLength];
+    // Rates restored if no setting passes, indexed by job
+    static Spi_BaudRateType Previous[SpiMaxJob];
+    Std_ReturnType retStatus = E_OK;
+    Spi_BaudRateType BaudRate;
+    Spi_BaudRateType Selected = SPI_BAUD_RATE_CLK_DIV256;
+    boolean Passed = FALSE;
+    uint16 JobIdx;
+    uint8 Rep;
 
-    volatile uint32 *SPI_CR1;
-    // Channel instance
-  //  Spi_ChannelConfigType Spi_CurrentChConfig;
-    volatile Spi_ChannelType Spi_CurrentCh;
-    uint8 SpiChIdx = 0;
-
-    // Job instance
-    // Spi_JobConfigType Spi_CurrentJobConfig = Spi_ConfigPtr->Spi_JobConfigPtr[SpiJobId];
-    Spi_HWunitType HW_Unit = Spi_ConfigPtr->Spi_JobConfigPtr[SpiJobId].SpiHwUnit;
-
-    // transmission Struct
-    volatile TransmitionType Transmit_Struct;
-
-    // Identify used HW unit
-    switch (HW_Unit)
+    if (Spi_ConfigPtr == NULL_PTR)
     {
-    case SPI1_HW_UNIT:
-        Transmit_Struct.SPI_DR = &SPI1_DR;
-        Transmit_Struct.SPI_SR = &SPI1_SR;
-        SPI_CR1 = &SPI1_CR1;
-        break;
-    case SPI2_HW_UNIT:
-        Transmit_Struct.SPI_DR = &SPI2_DR;
-        Transmit_Struct.SPI_SR = &SPI2_SR;
-        SPI_CR1 = &SPI2_CR1;
-        break;
-    default:
-        // Shoulnd't be here
-        Transmit_Struct.SPI_DR = NULL_PTR;
-        Transmit_Struct.SPI_SR = NULL_PTR;
-        break;
+#ifdef SpiDevErrorDetect
+        Det_ReportError(SPI_ModuleId, 0, Spi_ApiID_Spi_CalibrateBaudRate, SPI_E_UNINIT);
+#endif
+        retStatus = E_NOT_OK;
     }
-
-    // Clk polarity select
-    switch (Spi_ConfigPtr->Spi_JobConfigPtr[SpiJobId].SpiClkPol)
+    else if (Sequence >= SpiMaxSequence || Channel >= SpiMaxChannel)
     {
-    case SPI_CLK_POL_HIGH:
-        SET_BIT(*SPI_CR1, SPI_CR1_CPOL); //idle = 1
-        break;
-    case SPI_CLK_POL_LOW:
-        CLR_BIT(*SPI_CR1, SPI_CR1_CPOL); //idle = 0
-        break;
-    default:
-        // ERROR
-        break;
+#ifdef SpiDevErrorDetect
+        Det_ReportError(SPI_ModuleId, 0, Spi_ApiID_Spi_CalibrateBaudRate, SPI_E_PARAM_SEQ);
+#endif
+        retStatus = E_NOT_OK;
     }
-
-    // Clk phase select
-    switch (Spi_ConfigPtr->Spi_JobConfigPtr[SpiJobId].SpiClkPhase)
+    else if (PatternPtr == NULL_PTR)
     {
-    case SPI_CLK_PHASE_FIRST:
-        CLR_BIT(*SPI_CR1, SPI_CR1_CPHA); // Data on First Clock
-        break;
-    case SPI_CLK_PHASE_SECOND:
-        SET_BIT(*SPI_CR1, SPI_CR1_CPHA); // Data on Second Clock
-        break;
-    default:
-        // ERROR
-        break;
+#ifdef SpiDevErrorDetect
+        Det_ReportError(SPI_ModuleId, 0, Spi_ApiID_Spi_CalibrateBaudRate, SPI_E_PARAM_POINTER);
+#endif
+        retStatus = E_NOT_OK;
     }
-
-    // Baud Rate Select
-    *(SPI_CR1) &= (~((uint32)Spi_ConfigPtr->Spi_JobConfigPtr[SpiJobId].SpiBaudRate << SPI_CR1_BR0));
-    *(SPI_CR1) |= ((uint32)Spi_ConfigPtr->Spi_JobConfigPtr[SpiJobId].SpiBaudRate << SPI_CR1_BR0);
-
-    // Clear ss pin (Active low)
-    if (Spi_ConfigPtr->Spi_JobConfigPtr[SpiJobId].SpiCsOn == TRUE)
+    else if (Length == 0 || Length > SpiCalibrationMaxLength || Repetitions == 0)
     {
-        // HW handle of SS bit
-        CLR_BIT(*SPI_CR1, SPI_CR1_SSM);
-        CLR_BIT(*SPI_CR1, SPI_CR1_SSI);
+#ifdef SpiDevErrorDetect
+        Det_ReportError(SPI_ModuleId, 0, Spi_ApiID_Spi_CalibrateBaudRate, SPI_E_PARAM_LENGTH);
+#endif
+        retStatus = E_NOT_OK;
     }
     else
     {
-        // SW handle of SS bit
-        SET_BIT(*SPI_CR1, SPI_CR1_SSI);
-        SET_BIT(*SPI_CR1, SPI_CR1_SSM);
-        Dio_WriteChannel(Spi_ConfigPtr->Spi_JobConfigPtr[SpiJobId].SpiCSPin, STD_LOW);
-    }
-
-    // Scan all channels in the job availabe to send
-    for (SpiChIdx = 0; SpiChIdx < Spi_ConfigPtr->Spi_JobConfigPtr[SpiJobId].No_Channel; SpiChIdx++)
-    {
+        const Spi_SeqConfigType *SeqPtr = &Spi_ConfigPtr->Spi_SeqConfigPtr[Sequence];
 
-        // Access channel with ID ChnlLinkPtrPhysical[SpiChIdx] from the main config struct
-        Spi_CurrentCh = Spi_ConfigPtr->Spi_JobConfigPtr[SpiJobId].ChnlLinkPtrPhysical[SpiChIdx];
-      //  Spi_CurrentChConfig = Spi_ConfigPtr->Spi_ChannelConfigPtr[Spi_CurrentCh];
+        for (JobIdx = 0; JobIdx < SeqPtr->NoOfJobs; JobIdx++)
+        {
+            Previous[SeqPtr->JobLinkPtr[JobIdx]] = Spi_JobBaudRate[SeqPtr->JobLinkPtr[JobIdx]];
+        }
 
-        // Config LSB / MSB
-        switch (Spi_ConfigPtr->Spi_ChannelConfigPtr[Spi_CurrentCh].SpiTransferStart)
+        if (ExpectedPtr == NULL_PTR)
         {
-        case SPI_LSB_FIRST:
-            SET_BIT(*SPI_CR1, SPI_CR1_LSBF); // LSB sent first
-            break;
-        case SPI_LSB_LAST:
-            CLR_BIT(*SPI_CR1, SPI_CR1_LSBF); // MSB sent first
-            break;
-        default:
-            break;
+            ExpectedPtr = PatternPtr;
         }
 
-        if (Spi_ConfigPtr->Spi_ChannelConfigPtr[Spi_CurrentCh].ChannelType == SpiChannelBufferIB)
+        // Slowest to fastest, stop at the first setting with errors
+        BaudRate = SPI_BAUD_RATE_CLK_DIV256;
+        do
         {
-            // Check if IB is null
-            if (Spi_IB[Spi_CurrentCh] == NULL_PTR)
+            uint8 BitErrors = 0;
+
+            for (JobIdx = 0; JobIdx < SeqPtr->NoOfJobs; JobIdx++)
+            {
+                Spi_JobBaudRate[SeqPtr->JobLinkPtr[JobIdx]] = BaudRate;
+            }
+            for (Rep = 0; Rep < Repetitions && BitErrors == 0 && retStatus == E_OK; Rep++)
+            {
+                retStatus = Spi_SetupEB(Channel, PatternPtr, RxBuffer, Length);
+                if (retStatus == E_OK)
+                {
+                    retStatus = Spi_SyncTransmit(Sequence);
+                }
+                if (retStatus == E_OK)
+                {
+                    BitErrors = Spi_StaticCountBitErrors(RxBuffer, ExpectedPtr, Length);
+                }
+            }
+
+            if (retStatus == E_OK && BitErrors == 0)
             {
-                Transmit_Struct.Srcdata = &Spi_ConfigPtr->Spi_ChannelConfigPtr[Spi_CurrentCh].SpiDefaultData;
+                Passed = TRUE;
+                Selected = BaudRate;
             }
             else
             {
-                Transmit_Struct.Srcdata = Spi_IB[Spi_CurrentCh];
+                break;
             }
-            Transmit_Struct.Desdata = NULL_PTR;
-            Transmit_Struct.Length = Spi_ConfigPtr->Spi_ChannelConfigPtr[Spi_CurrentCh].NoOfDataElements;
-        }
-        else
+        } while (BaudRate-- != SPI_BAUD_RATE_CLK_DIV2);
+
+        if (Passed == TRUE)
         {
-            if (Spi_EBInstance[Spi_CurrentCh].srcDataPtr == NULL_PTR)
+            // Margin: go back towards the slower settings
+            Selected = (Selected + SpiCalibrationMarginSteps > SPI_BAUD_RATE_CLK_DIV256) ?
+                           SPI_BAUD_RATE_CLK_DIV256 : (Spi_BaudRateType)(Selected + SpiCalibrationMarginSteps);
+            retStatus = E_OK;
+
+            for (JobIdx = 0; JobIdx < SeqPtr->NoOfJobs; JobIdx++)
             {
-                Transmit_Struct.Srcdata = &Spi_ConfigPtr->Spi_ChannelConfigPtr[Spi_CurrentCh].SpiDefaultData;
+                Spi_JobBaudRate[SeqPtr->JobLinkPtr[JobIdx]] = Selected;
             }
-            else
+            if (SelectedPtr != NULL_PTR)
             {
-                Transmit_Struct.Srcdata = Spi_EBInstance[Spi_CurrentCh].srcDataPtr;
+                *SelectedPtr = Selected;
             }
-            Transmit_Struct.Desdata = Spi_EBInstance[Spi_CurrentCh].DestDataPtr;
-            Transmit_Struct.Length = Spi_EBInstance[Spi_CurrentCh].Length;
         }
-
-        // Select Data Frame Format
-        switch (Spi_ConfigPtr->Spi_ChannelConfigPtr[Spi_CurrentCh].SpiDataWidth)
+        else
         {
-        case SPI_DFF_MODE_8Bit:
-            CLR_BIT(*SPI_CR1, SPI_CR1_DFF); // 8-Bit data Selected
-            break;
-        case SPI_DFF_MODE_16Bit:
-            SET_BIT(*SPI_CR1, SPI_CR1_DFF); // 16-Bit data Selected
-            break;
-        default:
-            break;
+            for (JobIdx = 0; JobIdx < SeqPtr->NoOfJobs; JobIdx++)
+            {
+                Spi_JobBaudRate[SeqPtr->JobLinkPtr[JobIdx]] = Previous[SeqPtr->JobLinkPtr[JobIdx]];
+            }
+            retStatus = E_NOT_OK;
         }
+    }
+    return retStatus;
+}
+#endif
 
-        // Send Data
-        SPI_StaticStartTransmission(Transmit_Struct);
-    } // End of channels in the Job
+#ifdef SpiTransferProgramApi
+/**
+    * @name : Spi_RunProgram
+    * @param: Job: Job giving the HW unit, clock settings and chip select
+    *         ProgramPtr: Program built with the SPI_PROG_xx macros
+    *         ProgramLength: Size of the program in bytes (sizeof the array)
+    *         BuffersPtr: Buffers referenced by the program, NULL_PTR if none
+    *         NoOfBuffers: Number of buffers
+    * Reentrancy: Non Reentrant
+    * @Return:  E_OK: Program reached SPI_PROG_END
+    *           E_NOT_OK: Bus busy, called from an interrupt, poll timeout, buffer 
+    *                     overflow, invalid opcode / operand or program not ended 
+    *                     within ProgramLength. 
+    *                     Chip select is released and the job result is SPI_JOB_FAILED.
+    * Sync
+    * @Description: Runs a whole device interaction (commands, status polling, 
+    *               reads in a loop) in one call without going back to the caller 
+    *               between transfers.
+    *               Task context only: the caller busy-waits on the bus for the whole
+    *               program (a SPI_PROG_POLL alone can take up to tries exchanges),
+    *               calls from an interrupt handler are rejected.
+**/
+Std_ReturnType Spi_RunProgram(Spi_JobType Job, const uint8 *ProgramPtr, uint16 ProgramLength,
+                              Spi_ProgramBufferType *BuffersPtr, uint8 NoOfBuffers)
+{
+    Std_ReturnType ret = E_OK;
+    volatile TransmitionType Transmit_Struct;
+    uint16 Pc = 0;
+    uint16 LoopStart[SpiProgramMaxNesting];
+    uint16 LoopCount[SpiProgramMaxNesting];
+    uint8 LoopDepth = 0;
+    uint8 LastRx = 0;
+    boolean CsAsserted = FALSE;
+    boolean Running = TRUE;
+    uint8 OpCode;
+    uint8 Idx;
+    uint8 Count;
+    uint16 Tries;
+    Spi_ProgramBufferType *BufPtr;
+
+    if (Spi_ConfigPtr == NULL_PTR)
+    {
+#ifdef SpiDevErrorDetect
+        Det_ReportError(SPI_ModuleId, 0, Spi_ApiID_Spi_RunProgram, SPI_E_UNINIT);
+#endif
+        return E_NOT_OK;
+    }
+    if (Job >= SpiMaxJob || ProgramPtr == NULL_PTR || (NoOfBuffers != 0 && BuffersPtr == NULL_PTR))
+    {
+#ifdef SpiDevErrorDetect
+        Det_ReportError(SPI_ModuleId, 0, Spi_ApiID_Spi_RunProgram, (Job >= SpiMaxJob) ? SPI_E_PARAM_JOB : SPI_E_PARAM_POINTER);
+#endif
+        return E_NOT_OK;
+    }
+    if (ProgramLength == 0)
+    {
+#ifdef SpiDevErrorDetect
+        Det_ReportError(SPI_ModuleId, 0, Spi_ApiID_Spi_RunProgram, SPI_E_PARAM_LENGTH);
+#endif
+        return E_NOT_OK;
+    }
+    // Handler mode (active exception): the program would stall the interrupt
+    if ((SCB_ICSR & SCB_ICSR_VECTACTIVE_MASK) != 0 ||
+        Spi_GetStatus() != SPI_IDLE ||
+        Spi_StaticGetUnitMode(Spi_ConfigPtr->Spi_JobConfigPtr[Job].SpiHwUnit) != SPI_MASTER_MODE)
+    {
+        return E_NOT_OK;
+    }
 
-    // set SS pin
-    if (Spi_ConfigPtr->Spi_JobConfigPtr[SpiJobId].SpiCsOn == TRUE)
+    if (Spi_ConfigPtr->Spi_JobConfigPtr[Job].SpiHwUnit == SPI1_HW_UNIT)
     {
-        // HW handle of SS bit
-        SET_BIT(*SPI_CR1, SPI_CR1_SSI);
+        Spi1_Status = SPI_BUSY;
     }
     else
     {
-        // SW handle of SS bit
-        Dio_WriteChannel(Spi_ConfigPtr->Spi_JobConfigPtr[SpiJobId].SpiCSPin, STD_HIGH);
+        Spi2_Status = SPI_BUSY;
     }
-}
+    Spi_JobResult[Job] = SPI_JOB_PENDING;
 
-/**
- * name : Dio_WriteChannel
- * param: ChannelId: ID of DIO channel 
- *            Level: Value to be written
- * Reentrancy: Reentrant
- * Sync
- * Description: Service to set a level of a channel.
- **/
-static void Dio_WriteChannel(Spi_CS_Pin ChannelId, Std_ReturnType Level)
-{
-    if (ChannelId >= PORTA_CHANNEL_OFFEST && ChannelId < PORTx_CHANNEL_OFFSET)
+    for (Idx = 0; Idx < NoOfBuffers; Idx++)
     {
-        // OK proceed
-        /* 
-        * USE BSRR and BRR registers to provide atomic channel access 
-        */
-        if (ChannelId >= PORTA_CHANNEL_OFFEST &&
-            ChannelId < PORTB_CHANNEL_OFFEST)
+        BuffersPtr[Idx].Cursor = 0;
+    }
+
+    // 8 bit, MSB first, full duplex
+    Spi_StaticSetupUnit(Job, &Transmit_Struct);
+    CLR_BIT(*(Transmit_Struct.SPI_CR1), SPI_CR1_DFF);
+    CLR_BIT(*(Transmit_Struct.SPI_CR1), SPI_CR1_LSBF);
+    CLR_BIT(*(Transmit_Struct.SPI_CR1), SPI_CR1_RXONLY);
+    CLR_BIT(*(Transmit_Struct.SPI_CR1), SPI_CR1_BIDIMODE);
+    SET_BIT(*(Transmit_Struct.SPI_CR1), SPI_CR1_SPE);
+
+    while (Running == TRUE && ret == E_OK)
+    {
+        // Opcode and its operands must be inside the program
+        if (Pc >= ProgramLength)
         {
-            switch (Level)
-            {
-            case STD_HIGH:
-                SET_BIT(GPIOA_BSRR, ChannelId); // Set Channel
-                break;
-            case STD_LOW:
-                SET_BIT(GPIOA_BRR, ChannelId); // Reset Channel
+            ret = E_NOT_OK;
+            break;
+        }
+        OpCode = ProgramPtr[Pc++];
+        if ((uint32)Pc + Spi_StaticOperandBytes(ProgramPtr, Pc, ProgramLength, OpCode) > ProgramLength)
+        {
+            ret = E_NOT_OK;
+            break;
+        }
+        switch (OpCode)
+        {
+        case SPI_OP_END:
+            Running = FALSE;
+            break;
+
+        case SPI_OP_CS_ASSERT:
+            Spi_StaticCsAssert(Job, Transmit_Struct.SPI_CR1);
+            CsAsserted = TRUE;
+            break;
+
+        case SPI_OP_CS_RELEASE:
+            // Last frame must be out before the slave is released
+            while (GET_BIT(*(Transmit_Struct.SPI_SR), SPI_SR_BSY) != 0)
+                ;
+            Spi_StaticCsRelease(Job, Transmit_Struct.SPI_CR1);
+            CsAsserted = FALSE;
+            break;
+
+        case SPI_OP_TX_INLINE:
+            Count = ProgramPtr[Pc++];
+            for (Idx = 0; Idx < Count; Idx++)
+            {
+                LastRx = Spi_StaticExchange(&Transmit_Struct, ProgramPtr[Pc++]);
+            }
+            break;
+
+        case SPI_OP_TX_BUFFER:
+        case SPI_OP_RX_BUFFER:
+            Idx = ProgramPtr[Pc++];
+            Count = ProgramPtr[Pc++];
+            if (Idx >= NoOfBuffers || (uint32)BuffersPtr[Idx].Cursor + Count > BuffersPtr[Idx].Size)
+            {
+                ret = E_NOT_OK;
+                break;
+            }
+            BufPtr = &BuffersPtr[Idx];
+            for (; Count != 0; Count--)
+            {
+                if (OpCode == SPI_OP_TX_BUFFER)
+                {
+                    LastRx = Spi_StaticExchange(&Transmit_Struct, BufPtr->DataPtr[BufPtr->Cursor]);
+                }
+                else
+                {
+                    LastRx = Spi_StaticExchange(&Transmit_Struct, SpiProgramFillByte);
+                    BufPtr->DataPtr[BufPtr->Cursor] = LastRx;
+                }
+                BufPtr->Cursor++;
+            }
+            break;
+
+        case SPI_OP_POLL:
+            Tries = (uint16)ProgramPtr[Pc + 3] | ((uint16)ProgramPtr[Pc + 4] << 8);
+            if (Tries == 0)
+            {
+                ret = E_NOT_OK;
+                break;
+            }
+            do
+            {
+                LastRx = Spi_StaticExchange(&Transmit_Struct, ProgramPtr[Pc]);
+                Tries--;
+            } while ((LastRx & ProgramPtr[Pc + 1]) != ProgramPtr[Pc + 2] && Tries != 0);
+            if ((LastRx & ProgramPtr[Pc + 1]) != ProgramPtr[Pc + 2])
+            {
+                ret = E_NOT_OK;
+            }
+            Pc += 5;
+            break;
+
+        case SPI_OP_LOOP:
+        case SPI_OP_LOOP_LAST_RX:
+            Count = (OpCode == SPI_OP_LOOP) ? ProgramPtr[Pc++] : LastRx;
+            if (Count == 0)
+            {
+                Pc = Spi_StaticSkipLoop(ProgramPtr, Pc, ProgramLength);
+            }
+            else if (LoopDepth >= SpiProgramMaxNesting)
+            {
+                ret = E_NOT_OK;
+            }
+            else
+            {
+                LoopStart[LoopDepth] = Pc;
+                LoopCount[LoopDepth] = Count;
+                LoopDepth++;
+            }
+            break;
+
+        case SPI_OP_END_LOOP:
+            if (LoopDepth == 0)
+            {
+                ret = E_NOT_OK;
+            }
+            else if (--LoopCount[LoopDepth - 1] != 0)
+            {
+                Pc = LoopStart[LoopDepth - 1];
+            }
+            else
+            {
+                LoopDepth--;
+            }
+            break;
+
+        default:
+            // Invalid opcode
+            ret = E_NOT_OK;
+            break;
+        }
+    }
+
+    while (GET_BIT(*(Transmit_Struct.SPI_SR), SPI_SR_BSY) != 0)
+        ;
+    if (CsAsserted == TRUE)
+    {
+        Spi_StaticCsRelease(Job, Transmit_Struct.SPI_CR1);
+    }
+    CLR_BIT(*(Transmit_Struct.SPI_CR1), SPI_CR1_SPE);
+
+    Spi_JobResult[Job] = (ret == E_OK) ? SPI_JOB_OK : SPI_JOB_FAILED;
+    if (Spi_ConfigPtr->Spi_JobConfigPtr[Job].SpiHwUnit == SPI1_HW_UNIT)
+    {
+        Spi1_Status = SPI_IDLE;
+    }
+    else
+    {
+        Spi2_Status = SPI_IDLE;
+    }
+    return ret;
+}
+#endif
+
+#ifdef SpiSlaveSupport
+/**
+    * @name : Spi_SlaveGetAvailable
+    * @param: HWUnit: Slave HW unit (SPI1_HW_UNIT / SPI2_HW_UNIT)
+    * Reentrancy: Non Reentrant for the same unit
+    * @Return: Number of received bytes not consumed yet (at most the ring size)
+    * Sync
+    * @Description: Returns the bytes waiting in the receive ring. 
+    *               Bytes overwritten by the DMA before being consumed are dropped 
+    *               and added to the overrun count.
+**/
+Spi_NumberOfDataType Spi_SlaveGetAvailable(Spi_HWunitType HWUnit)
+{
+    Spi_NumberOfDataType Available = 0;
+    Spi_SlaveUnitType *UnitPtr = Spi_StaticGetSlaveUnit(HWUnit, Spi_ApiID_Spi_SlaveGetAvailable);
+
+    if (UnitPtr != NULL_PTR)
+    {
+        Available = Spi_StaticSlaveAvailable(UnitPtr);
+    }
+    return Available;
+}
+
+/**
+    * @name : Spi_SlaveRead
+    * @param: HWUnit: Slave HW unit
+    *         DataBufferPtr: Destination buffer
+    *         Length: Maximum number of bytes to read
+    * Reentrancy: Non Reentrant for the same unit
+    * @Return: Number of bytes copied and consumed
+    * Sync
+    * @Description: Copies the oldest received bytes out of the ring and consumes them.
+**/
+Spi_NumberOfDataType Spi_SlaveRead(Spi_HWunitType HWUnit, Spi_DataBufferType *DataBufferPtr, Spi_NumberOfDataType Length)
+{
+    Spi_NumberOfDataType ReadCount = 0;
+    Spi_NumberOfDataType Available;
+    Spi_NumberOfDataType RingIdx;
+    Spi_NumberOfDataType RingSize;
+    Spi_SlaveUnitType *UnitPtr = Spi_StaticGetSlaveUnit(HWUnit, Spi_ApiID_Spi_SlaveRead);
+
+#ifdef SpiDevErrorDetect
+    if (DataBufferPtr == NULL_PTR)
+    {
+        Det_ReportError(SPI_ModuleId, 0, Spi_ApiID_Spi_SlaveRead, SPI_E_PARAM_POINTER);
+        UnitPtr = NULL_PTR;
+    }
+#endif
+    if (UnitPtr != NULL_PTR)
+    {
+        RingSize = UnitPtr->ConfigPtr->SpiRxRingSize;
+        Available = Spi_StaticSlaveAvailable(UnitPtr);
+        RingIdx = (Spi_NumberOfDataType)(UnitPtr->RxConsumed % RingSize);
+
+        for (ReadCount = 0; ReadCount < Length && ReadCount < Available; ReadCount++)
+        {
+            DataBufferPtr[ReadCount] = UnitPtr->ConfigPtr->SpiRxRingPtr[RingIdx];
+            RingIdx++;
+            if (RingIdx == RingSize)
+            {
+                RingIdx = 0;
+            }
+        }
+        UnitPtr->RxConsumed += ReadCount;
+    }
+    return ReadCount;
+}
+
+/**
+    * @name : Spi_SlaveConsume
+    * @param: HWUnit: Slave HW unit
+    *         Length: Number of bytes to drop
+    * Reentrancy: Non Reentrant for the same unit
+    * @Return:  E_OK: Bytes consumed
+    *           E_NOT_OK: Less than Length bytes available
+    * Sync
+    * @Description: Consumes bytes the user parsed in place through SpiRxRingPtr.
+**/
+Std_ReturnType Spi_SlaveConsume(Spi_HWunitType HWUnit, Spi_NumberOfDataType Length)
+{
+    Std_ReturnType retStatus = E_NOT_OK;
+    Spi_SlaveUnitType *UnitPtr = Spi_StaticGetSlaveUnit(HWUnit, Spi_ApiID_Spi_SlaveConsume);
+
+    if (UnitPtr != NULL_PTR && Length <= Spi_StaticSlaveAvailable(UnitPtr))
+    {
+        UnitPtr->RxConsumed += Length;
+        retStatus = E_OK;
+    }
+    return retStatus;
+}
+
+/**
+    * @name : Spi_SlaveSetReply
+    * @param: HWUnit: Slave HW unit
+    *         ReplyPtr: Reply data, must stay valid until it is sent
+    *         Length: Number of bytes of the reply
+    * Reentrancy: Non Reentrant for the same unit
+    * @Return:  E_OK: Reply queued
+    *           E_NOT_OK: Previous reply still being sent
+    * Sync
+    * @Description: Preloads the bytes sent on the next frames clocked by the master. 
+    *               Call it while the master is idle, the first byte is moved to the 
+    *               TX buffer immediately. Once the reply is sent the unit repeats 
+    *               the last frame until the next reply, a reply ending with an
+    *               idle / filler byte keeps the master reading that byte.
+**/
+Std_ReturnType Spi_SlaveSetReply(Spi_HWunitType HWUnit, const Spi_DataBufferType *ReplyPtr, Spi_NumberOfDataType Length)
+{
+    Std_ReturnType retStatus = E_NOT_OK;
+    Spi_SlaveUnitType *UnitPtr = Spi_StaticGetSlaveUnit(HWUnit, Spi_ApiID_Spi_SlaveSetReply);
+
+#ifdef SpiDevErrorDetect
+    if (ReplyPtr == NULL_PTR)
+    {
+        Det_ReportError(SPI_ModuleId, 0, Spi_ApiID_Spi_SlaveSetReply, SPI_E_PARAM_POINTER);
+        UnitPtr = NULL_PTR;
+    }
+    else if (Length == 0)
+    {
+        Det_ReportError(SPI_ModuleId, 0, Spi_ApiID_Spi_SlaveSetReply, SPI_E_PARAM_LENGTH);
+        UnitPtr = NULL_PTR;
+    }
+#endif
+    if (UnitPtr != NULL_PTR && GET_BIT(DMA1_CCR(UnitPtr->TxDmaChannel), DMA_CCR_EN) == 0)
+    {
+        // Memory to peripheral, memory increment, one shot, TC releases the channel
+        DMA1_CCR(UnitPtr->TxDmaChannel) = (1UL << DMA_CCR_DIR) | (1UL << DMA_CCR_MINC) | (1UL << DMA_CCR_TCIE);
+        DMA1_CPAR(UnitPtr->TxDmaChannel) = (uint32)UnitPtr->SPI_DR;
+        DMA1_CMAR(UnitPtr->TxDmaChannel) = (uint32)ReplyPtr;
+        DMA1_CNDTR(UnitPtr->TxDmaChannel) = Length;
+        SET_BIT(DMA1_CCR(UnitPtr->TxDmaChannel), DMA_CCR_EN);
+        retStatus = E_OK;
+    }
+    return retStatus;
+}
+
+/**
+    * @name : Spi_SlaveGetOverrunCount
+    * @param: HWUnit: Slave HW unit
+    * Reentrancy: Reentrant
+    * @Return: Number of received bytes lost since init
+    * Sync
+    * @Description: Bytes are lost when the user lets the ring fill up; 
+    *               they are accounted the next time the ring is accessed.
+**/
+uint32 Spi_SlaveGetOverrunCount(Spi_HWunitType HWUnit)
+{
+    uint32 OverrunCount = 0;
+    Spi_SlaveUnitType *UnitPtr = Spi_StaticGetSlaveUnit(HWUnit, Spi_ApiID_Spi_SlaveGetOverrunCount);
+
+    if (UnitPtr != NULL_PTR)
+    {
+        (void)Spi_StaticSlaveAvailable(UnitPtr);
+        OverrunCount = UnitPtr->OverrunCount;
+    }
+    return OverrunCount;
+}
+
+/* DMA1 channel vectors of the slave units */
+void DMA1_Channel2_IRQHandler(void)
+{
+    Spi_StaticSlaveRxIsr(&Spi_SlaveUnit[0]);
+}
+
+void DMA1_Channel3_IRQHandler(void)
+{
+    Spi_StaticSlaveTxIsr(&Spi_SlaveUnit[0]);
+}
+
+void DMA1_Channel4_IRQHandler(void)
+{
+    Spi_StaticSlaveRxIsr(&Spi_SlaveUnit[1]);
+}
+
+void DMA1_Channel5_IRQHandler(void)
+{
+    Spi_StaticSlaveTxIsr(&Spi_SlaveUnit[1]);
+}
+#endif
+/************************************************************************/
+/*                    Local functions Definitions                       */
+/************************************************************************/
+
+/**
+* @name : SPI_StaticStartTransmission
+* @param: HW_Unit: Associated HW unit 
+* 			  Srcdata: source data buffer 
+* 			  Destdata: destination data buffer
+*					Length: Length of data buffer
+* @Description: local function to start transmition of array of data and store the result.
+**/
+static void SPI_StaticStartTransmission(TransmitionType TransmitStrcut)
+{
+    uint16 idx = 0;
+    uint16 RxData;
+
+    // Send Data
+    for (idx = 0; idx < TransmitStrcut.Length; idx++)
+    {
+        // Wait for Tx buffer empty
+        while (GET_BIT(*(TransmitStrcut.SPI_SR), SPI_SR_TXE) == 0)
+            ;
+        if (TransmitStrcut.Srcdata == NULL_PTR)
+        {
+            *(TransmitStrcut.SPI_DR) = TransmitStrcut.DefaultData;
+        }
+        else if (TransmitStrcut.DataWidth == SPI_DFF_MODE_16Bit)
+        {
+            *(TransmitStrcut.SPI_DR) = ((const uint16 *)TransmitStrcut.Srcdata)[idx];
+        }
+        else
+        {
+            *(TransmitStrcut.SPI_DR) = TransmitStrcut.Srcdata[idx];
+        }
+        // Full duplex: every sent frame clocks one frame in
+        while (GET_BIT(*(TransmitStrcut.SPI_SR), SPI_SR_RXNE) == 0)
+            ;
+        // Reading DR clears RXNE, so it is read even if nobody wants the data
+        RxData = (uint16)(*(TransmitStrcut.SPI_DR));
+        if (TransmitStrcut.Desdata == NULL_PTR)
+        {
+            // Discard
+        }
+        else if (TransmitStrcut.DataWidth == SPI_DFF_MODE_16Bit)
+        {
+            ((uint16 *)TransmitStrcut.Desdata)[idx] = RxData;
+        }
+        else
+        {
+            TransmitStrcut.Desdata[idx] = (Spi_DataBufferType)RxData;
+        }
+    }
+    // Wait for Busy Flag
+    while (GET_BIT(*(TransmitStrcut.SPI_SR), SPI_SR_BSY) != 0)
+        ;
+    return;
+}
+
+/**
+* @name : SPI_StaticStartPackedTransmission
+* @param: TransmitStrcut: 8-bit buffers, Length in bytes
+* @Description: Full-duplex transfer of Length / 2 byte pairs with the unit in 16-bit 
+*				 frame format. The half-word keeps the byte order on the wire: 
+*				 MSB first sends its high byte first -> (b0 << 8) | b1 
+*				 LSB first sends its low byte first  -> (b1 << 8) | b0 
+*				 Unit must be enabled in 16-bit mode by the caller.
+**/
+static void SPI_StaticStartPackedTransmission(TransmitionType TransmitStrcut)
+{
+    uint16 idx = 0;
+    uint16 Frame;
+    uint8 FirstShift = (TransmitStrcut.TransferStart == SPI_LSB_FIRST) ? 0U : 8U;
+    uint8 SecondShift = 8U - FirstShift;
+
+    for (idx = 0; idx + 1 < TransmitStrcut.Length; idx += 2)
+    {
+        if (TransmitStrcut.Srcdata == NULL_PTR)
+        {
+            Frame = (uint16)(((uint16)TransmitStrcut.DefaultData << 8) | TransmitStrcut.DefaultData);
+        }
+        else
+        {
+            Frame = (uint16)(((uint16)TransmitStrcut.Srcdata[idx] << FirstShift) |
+                             ((uint16)TransmitStrcut.Srcdata[idx + 1] << SecondShift));
+        }
+        while (GET_BIT(*(TransmitStrcut.SPI_SR), SPI_SR_TXE) == 0)
+            ;
+        *(TransmitStrcut.SPI_DR) = Frame;
+
+        while (GET_BIT(*(TransmitStrcut.SPI_SR), SPI_SR_RXNE) == 0)
+            ;
+        Frame = (uint16)(*(TransmitStrcut.SPI_DR));
+        if (TransmitStrcut.Desdata != NULL_PTR)
+        {
+            TransmitStrcut.Desdata[idx] = (Spi_DataBufferType)(Frame >> FirstShift);
+            TransmitStrcut.Desdata[idx + 1] = (Spi_DataBufferType)(Frame >> SecondShift);
+        }
+    }
+    while (GET_BIT(*(TransmitStrcut.SPI_SR), SPI_SR_BSY) != 0)
+        ;
+    return;
+}
+
+/**
+* @name : SPI_StaticStartTransmitOnly
+* @param: TransmitStrcut: unit registers, source buffer and length
+* @Description: 3-wire output: frames are only written, receiver is off. 
+*				 Unit must be enabled by the caller.
+**/
+static void SPI_StaticStartTransmitOnly(TransmitionType TransmitStrcut)
+{
+    uint16 idx = 0;
+
+    for (idx = 0; idx < TransmitStrcut.Length; idx++)
+    {
+        while (GET_BIT(*(TransmitStrcut.SPI_SR), SPI_SR_TXE) == 0)
+            ;
+        if (TransmitStrcut.Srcdata == NULL_PTR)
+        {
+            *(TransmitStrcut.SPI_DR) = TransmitStrcut.DefaultData;
+        }
+        else if (TransmitStrcut.DataWidth == SPI_DFF_MODE_16Bit)
+        {
+            *(TransmitStrcut.SPI_DR) = ((const uint16 *)TransmitStrcut.Srcdata)[idx];
+        }
+        else
+        {
+            *(TransmitStrcut.SPI_DR) = TransmitStrcut.Srcdata[idx];
+        }
+    }
+    // Last frame left the TX buffer and the shift register
+    while (GET_BIT(*(TransmitStrcut.SPI_SR), SPI_SR_TXE) == 0)
+        ;
+    while (GET_BIT(*(TransmitStrcut.SPI_SR), SPI_SR_BSY) != 0)
+        ;
+    return;
+}
+
+/**
+* @name : SPI_StaticStartReceiveOnly
+* @param: TransmitStrcut: unit registers, destination buffer and length
+* @Description: RX only / 3-wire input: the master clocks continuously while SPE 
+*				 is set, nothing is written to DR. Enables and disables the unit 
+*				 itself following the RM0008 receive only stop procedure: 
+*				 wait for the (n-1)th RXNE, wait one SCK period (DWT cycle 
+*				 counter), clear SPE, then wait for the last RXNE. A single 
+*				 frame is stopped one SCK after SPE is set. 
+*				 The loop must keep up with the bus, at SPI_BAUD_RATE_CLK_DIV2 
+*				 the unit overruns. 
+**/
+static void SPI_StaticStartReceiveOnly(TransmitionType TransmitStrcut)
+{
+    uint16 idx = 0;
+    uint16 RxData;
+
+    if (TransmitStrcut.Length != 0)
+    {
+        // Drop a stale frame so that the first RXNE belongs to this channel
+        (void)*(TransmitStrcut.SPI_DR);
+        SET_BIT(*(TransmitStrcut.SPI_CR1), SPI_CR1_SPE);
+        if (TransmitStrcut.Length == 1)
+        {
+            Spi_StaticWaitCycles(TransmitStrcut.SckCycles);
+            CLR_BIT(*(TransmitStrcut.SPI_CR1), SPI_CR1_SPE);
+        }
+
+        for (idx = 0; idx < TransmitStrcut.Length; idx++)
+        {
+            while (GET_BIT(*(TransmitStrcut.SPI_SR), SPI_SR_RXNE) == 0)
+                ;
+            if (idx + 2U == TransmitStrcut.Length)
+            {
+                // (n-1)th frame in, the last one is being clocked: stop before it ends
+                Spi_StaticWaitCycles(TransmitStrcut.SckCycles);
+                CLR_BIT(*(TransmitStrcut.SPI_CR1), SPI_CR1_SPE);
+            }
+            RxData = (uint16)(*(TransmitStrcut.SPI_DR));
+            if (TransmitStrcut.Desdata == NULL_PTR)
+            {
+                // Discard
+            }
+            else if (TransmitStrcut.DataWidth == SPI_DFF_MODE_16Bit)
+            {
+                ((uint16 *)TransmitStrcut.Desdata)[idx] = RxData;
+            }
+            else
+            {
+                TransmitStrcut.Desdata[idx] = (Spi_DataBufferType)RxData;
+            }
+        }
+    }
+    return;
+}
+
+/**
+* @name : Spi_StaticWaitCycles
+* @param: Cycles: core clock cycles to wait
+* @Description: Busy wait on the DWT cycle counter, independent of the code
+*				 generated for the loop. Wraps of CYCCNT are handled by the 
+*				 unsigned difference.
+**/
+static void Spi_StaticWaitCycles(uint32 Cycles)
+{
+    uint32 Start = DWT_CYCCNT;
+
+    while ((DWT_CYCCNT - Start) < Cycles)
+        ;
+    return;
+}
+
+/**
+* @name : Spi_StaticHandleJob
+* @param: SpiJobId : Job ID
+* @Description: Handle Job transmition
+**/
+static void Spi_StaticHandleJob(Spi_JobType SpiJobId)
+{
+
+    volatile uint32 *SPI_CR1;
+    // Channel instance
+  //  Spi_ChannelConfigType Spi_CurrentChConfig;
+    volatile Spi_ChannelType Spi_CurrentCh;
+    uint8 SpiChIdx = 0;
+
+    // transmission Struct
+    volatile TransmitionType Transmit_Struct;
+
+    Spi_StaticSetupUnit(SpiJobId, &Transmit_Struct);
+    SPI_CR1 = Transmit_Struct.SPI_CR1;
+
+    // Clear ss pin (Active low)
+    Spi_StaticCsAssert(SpiJobId, SPI_CR1);
+
+    // Scan all channels in the job availabe to send
+    for (SpiChIdx = 0; SpiChIdx < Spi_ConfigPtr->Spi_JobConfigPtr[SpiJobId].No_Channel; SpiChIdx++)
+    {
+
+        // Access channel with ID ChnlLinkPtrPhysical[SpiChIdx] from the main config struct
+        Spi_CurrentCh = Spi_ConfigPtr->Spi_JobConfigPtr[SpiJobId].ChnlLinkPtrPhysical[SpiChIdx];
+      //  Spi_CurrentChConfig = Spi_ConfigPtr->Spi_ChannelConfigPtr[Spi_CurrentCh];
+
+        // Config LSB / MSB
+        switch (Spi_ConfigPtr->Spi_ChannelConfigPtr[Spi_CurrentCh].SpiTransferStart)
+        {
+        case SPI_LSB_FIRST:
+            SET_BIT(*SPI_CR1, SPI_CR1_LSBF); // LSB sent first
+            break;
+        case SPI_LSB_LAST:
+            CLR_BIT(*SPI_CR1, SPI_CR1_LSBF); // MSB sent first
+            break;
+        default:
+            break;
+        }
+
+        if (Spi_ConfigPtr->Spi_ChannelConfigPtr[Spi_CurrentCh].ChannelType == SpiChannelBufferIB)
+        {
+            // IB channels receive in place, Spi_ReadIB returns the received data
+            Transmit_Struct.Srcdata = SPI_IB_BUFFER(Spi_CurrentCh);
+            Transmit_Struct.Desdata = SPI_IB_BUFFER(Spi_CurrentCh);
+            Transmit_Struct.Length = Spi_ConfigPtr->Spi_ChannelConfigPtr[Spi_CurrentCh].NoOfDataElements;
+        }
+        else
+        {
+            // NULL source: default transmit value is sent for every element
+            Transmit_Struct.Srcdata = Spi_EBInstance[Spi_CurrentCh].srcDataPtr;
+            Transmit_Struct.Desdata = Spi_EBInstance[Spi_CurrentCh].DestDataPtr;
+            Transmit_Struct.Length = Spi_EBInstance[Spi_CurrentCh].Length;
+        }
+        Transmit_Struct.DefaultData = Spi_ConfigPtr->Spi_ChannelConfigPtr[Spi_CurrentCh].SpiDefaultData;
+        Transmit_Struct.DataWidth = Spi_ConfigPtr->Spi_ChannelConfigPtr[Spi_CurrentCh].SpiDataWidth;
+        Transmit_Struct.TransferStart = Spi_ConfigPtr->Spi_ChannelConfigPtr[Spi_CurrentCh].SpiTransferStart;
+
+        // Select Data Frame Format
+        switch (Spi_ConfigPtr->Spi_ChannelConfigPtr[Spi_CurrentCh].SpiDataWidth)
+        {
+        case SPI_DFF_MODE_8Bit:
+            CLR_BIT(*SPI_CR1, SPI_CR1_DFF); // 8-Bit data Selected
+            break;
+        case SPI_DFF_MODE_16Bit:
+            SET_BIT(*SPI_CR1, SPI_CR1_DFF); // 16-Bit data Selected
+            break;
+        default:
+            break;
+        }
+
+        // Select data direction, the loops below are specialised so that
+        // receive only channels never touch the TX path
+        switch (Spi_ConfigPtr->Spi_ChannelConfigPtr[Spi_CurrentCh].SpiChannelDirection)
+        {
+        case SPI_DIRECTION_RX_ONLY:
+            CLR_BIT(*SPI_CR1, SPI_CR1_BIDIMODE);
+            SET_BIT(*SPI_CR1, SPI_CR1_RXONLY);
+            // Clock runs as soon as SPE is set
+            SPI_StaticStartReceiveOnly(Transmit_Struct);
+            CLR_BIT(*SPI_CR1, SPI_CR1_RXONLY);
+            break;
+        case SPI_DIRECTION_BIDI_RX:
+            CLR_BIT(*SPI_CR1, SPI_CR1_RXONLY);
+            CLR_BIT(*SPI_CR1, SPI_CR1_BIDIOE);
+            SET_BIT(*SPI_CR1, SPI_CR1_BIDIMODE);
+            // Clock runs as soon as SPE is set
+            SPI_StaticStartReceiveOnly(Transmit_Struct);
+            CLR_BIT(*SPI_CR1, SPI_CR1_BIDIMODE);
+            break;
+        case SPI_DIRECTION_BIDI_TX:
+            CLR_BIT(*SPI_CR1, SPI_CR1_RXONLY);
+            SET_BIT(*SPI_CR1, SPI_CR1_BIDIOE);
+            SET_BIT(*SPI_CR1, SPI_CR1_BIDIMODE);
+            SET_BIT(*SPI_CR1, SPI_CR1_SPE);
+            SPI_StaticStartTransmitOnly(Transmit_Struct);
+            CLR_BIT(*SPI_CR1, SPI_CR1_SPE);
+            CLR_BIT(*SPI_CR1, SPI_CR1_BIDIMODE);
+            CLR_BIT(*SPI_CR1, SPI_CR1_BIDIOE);
+            break;
+        default:
+            // SPI_DIRECTION_FULL_DUPLEX
+            CLR_BIT(*SPI_CR1, SPI_CR1_RXONLY);
+            CLR_BIT(*SPI_CR1, SPI_CR1_BIDIMODE);
+
+            if (Spi_ConfigPtr->Spi_ChannelConfigPtr[Spi_CurrentCh].SpiFramePacking == TRUE &&
+                Transmit_Struct.DataWidth == SPI_DFF_MODE_8Bit && Transmit_Struct.Length >= 2)
+            {
+                // Byte pairs as 16-bit frames
+                SET_BIT(*SPI_CR1, SPI_CR1_DFF);
+                SET_BIT(*SPI_CR1, SPI_CR1_SPE);
+                SPI_StaticStartPackedTransmission(Transmit_Struct);
+                CLR_BIT(*SPI_CR1, SPI_CR1_SPE);
+                CLR_BIT(*SPI_CR1, SPI_CR1_DFF);
+
+                // Odd length: last byte as an 8-bit frame
+                if ((Transmit_Struct.Length & 1U) != 0)
+                {
+                    if (Transmit_Struct.Srcdata != NULL_PTR)
+                    {
+                        Transmit_Struct.Srcdata += Transmit_Struct.Length - 1;
+                    }
+                    if (Transmit_Struct.Desdata != NULL_PTR)
+                    {
+                        Transmit_Struct.Desdata += Transmit_Struct.Length - 1;
+                    }
+                    Transmit_Struct.Length = 1;
+                    SET_BIT(*SPI_CR1, SPI_CR1_SPE);
+                    SPI_StaticStartTransmission(Transmit_Struct);
+                    CLR_BIT(*SPI_CR1, SPI_CR1_SPE);
+                }
+            }
+            else
+            {
+                SET_BIT(*SPI_CR1, SPI_CR1_SPE);
+
+                // Send Data
+                SPI_StaticStartTransmission(Transmit_Struct);
+
+                CLR_BIT(*SPI_CR1, SPI_CR1_SPE);
+            }
+            break;
+        }
+    } // End of channels in the Job
+
+    // set SS pin
+    Spi_StaticCsRelease(SpiJobId, SPI_CR1);
+}
+
+/**
+* @name : Spi_StaticSetupUnit
+* @param: SpiJobId : Job ID
+*		  TransmitPtr: filled with the unit registers and baud rate
+* @Description: Disables the HW unit of the job and applies the job clock settings.
+**/
+static void Spi_StaticSetupUnit(Spi_JobType SpiJobId, volatile TransmitionType *TransmitPtr)
+{
+    Spi_HWunitType HW_Unit = Spi_ConfigPtr->Spi_JobConfigPtr[SpiJobId].SpiHwUnit;
+
+    // Identify used HW unit
+    switch (HW_Unit)
+    {
+    case SPI1_HW_UNIT:
+        TransmitPtr->SPI_DR = &SPI1_DR;
+        TransmitPtr->SPI_SR = &SPI1_SR;
+        TransmitPtr->SPI_CR1 = &SPI1_CR1;
+        break;
+    case SPI2_HW_UNIT:
+        TransmitPtr->SPI_DR = &SPI2_DR;
+        TransmitPtr->SPI_SR = &SPI2_SR;
+        TransmitPtr->SPI_CR1 = &SPI2_CR1;
+        break;
+    default:
+        // Shoulnd't be here
+        TransmitPtr->SPI_DR = NULL_PTR;
+        TransmitPtr->SPI_SR = NULL_PTR;
+        TransmitPtr->SPI_CR1 = NULL_PTR;
+        break;
+    }
+
+    // CPOL, CPHA, BR and DFF must not be changed while the unit is enabled
+    CLR_BIT(*(TransmitPtr->SPI_CR1), SPI_CR1_SPE);
+
+    // Clk polarity select
+    switch (Spi_ConfigPtr->Spi_JobConfigPtr[SpiJobId].SpiClkPol)
+    {
+    case SPI_CLK_POL_HIGH:
+        SET_BIT(*(TransmitPtr->SPI_CR1), SPI_CR1_CPOL); //idle = 1
+        break;
+    case SPI_CLK_POL_LOW:
+        CLR_BIT(*(TransmitPtr->SPI_CR1), SPI_CR1_CPOL); //idle = 0
+        break;
+    default:
+        // ERROR
+        break;
+    }
+
+    // Clk phase select
+    switch (Spi_ConfigPtr->Spi_JobConfigPtr[SpiJobId].SpiClkPhase)
+    {
+    case SPI_CLK_PHASE_FIRST:
+        CLR_BIT(*(TransmitPtr->SPI_CR1), SPI_CR1_CPHA); // Data on First Clock
+        break;
+    case SPI_CLK_PHASE_SECOND:
+        SET_BIT(*(TransmitPtr->SPI_CR1), SPI_CR1_CPHA); // Data on Second Clock
+        break;
+    default:
+        // ERROR
+        break;
+    }
+
+    // Baud Rate Select
+    *(TransmitPtr->SPI_CR1) &= (~((uint32)0x07 << SPI_CR1_BR0));
+    *(TransmitPtr->SPI_CR1) |= ((uint32)Spi_JobBaudRate[SpiJobId] << SPI_CR1_BR0);
+    TransmitPtr->SckCycles = ((HW_Unit == SPI1_HW_UNIT) ? SpiApb2ClockRatio : SpiApb1ClockRatio) *
+                             (2UL << Spi_JobBaudRate[SpiJobId]);
+}
+
+/**
+* @name : Spi_StaticCsAssert
+* @param: SpiJobId : Job ID
+*		  SPI_CR1: CR1 of the job HW unit
+* @Description: Selects the slave of the job.
+**/
+static void Spi_StaticCsAssert(Spi_JobType SpiJobId, volatile uint32 *SPI_CR1)
+{
+    // Clear ss pin (Active low)
+    switch (Spi_ConfigPtr->Spi_JobConfigPtr[SpiJobId].SpiCsSelection)
+    {
+    case SPI_CS_VIA_PERIPHERAL_ENGINE:
+        // HW handle of SS bit
+        CLR_BIT(*SPI_CR1, SPI_CR1_SSM);
+        CLR_BIT(*SPI_CR1, SPI_CR1_SSI);
+        break;
+    case SPI_CS_VIA_GPIO:
+        // SW handle of SS bit
+        SET_BIT(*SPI_CR1, SPI_CR1_SSI);
+        SET_BIT(*SPI_CR1, SPI_CR1_SSM);
+        Dio_WriteChannel(Spi_ConfigPtr->Spi_JobConfigPtr[SpiJobId].SpiCSPin, STD_LOW);
+        break;
+#ifdef SpiCsDecoderSupport
+    case SPI_CS_VIA_DECODER:
+    {
+        uint32 DecoderAddress = ((uint32)Spi_ConfigPtr->Spi_JobConfigPtr[SpiJobId].SpiCsDecoderAddress << SpiCsDecoderOffset) & SpiCsDecoderMask;
+
+        SET_BIT(*SPI_CR1, SPI_CR1_SSI);
+        SET_BIT(*SPI_CR1, SPI_CR1_SSM);
+        // Set the 1 bits and reset the 0 bits of the address in one store
+        SPI_CS_DECODER_BSRR = DecoderAddress | ((~DecoderAddress & SpiCsDecoderMask) << 16);
+        // Strobe: enable low selects the addressed output
+        SPI_CS_DECODER_EN_BSRR = (1UL << (SPI_CS_DECODER_EN_PIN + 16));
+        break;
+    }
+#endif
+    default:
+        // SPI_CS_VIA_USER: CS already asserted by the job owner
+        SET_BIT(*SPI_CR1, SPI_CR1_SSI);
+        SET_BIT(*SPI_CR1, SPI_CR1_SSM);
+        break;
+    }
+}
+
+/**
+* @name : Spi_StaticCsRelease
+* @param: SpiJobId : Job ID
+*		  SPI_CR1: CR1 of the job HW unit
+* @Description: Deselects the slave of the job.
+**/
+static void Spi_StaticCsRelease(Spi_JobType SpiJobId, volatile uint32 *SPI_CR1)
+{
+    // set SS pin
+    switch (Spi_ConfigPtr->Spi_JobConfigPtr[SpiJobId].SpiCsSelection)
+    {
+    case SPI_CS_VIA_PERIPHERAL_ENGINE:
+        // HW handle of SS bit
+        SET_BIT(*SPI_CR1, SPI_CR1_SSI);
+        break;
+    case SPI_CS_VIA_GPIO:
+        // SW handle of SS bit
+        Dio_WriteChannel(Spi_ConfigPtr->Spi_JobConfigPtr[SpiJobId].SpiCSPin, STD_HIGH);
+        break;
+#ifdef SpiCsDecoderSupport
+    case SPI_CS_VIA_DECODER:
+        // Enable high deselects every decoder output
+        SPI_CS_DECODER_EN_BSRR = (1UL << SPI_CS_DECODER_EN_PIN);
+        break;
+#endif
+    default:
+        // SPI_CS_VIA_USER: released by the job owner
+        break;
+    }
+}
+
+#if SpiChannelBuffersAllowed == SpiChannelBufferIB || SpiChannelBuffersAllowed == SpiChannelBufferIB_EB
+/**
+* @name : Spi_StaticWriteIB
+* @param: Channel: IB channel
+*         DataBufferPtr: NoOfDataElements elements (uint16 for 16 bit channels),
+*                        NULL_PTR: default transmit value
+* @Description: Fills the IB row of the channel.
+**/
+static void Spi_StaticWriteIB(Spi_ChannelType Channel, const Spi_DataBufferType *DataBufferPtr)
+{
+    uint16 BufferIdx = 0;
+
+    if (DataBufferPtr == NULL_PTR)
+    {
+        // Channel should transmit the default value
+        for (BufferIdx = 0; BufferIdx < Spi_ConfigPtr->Spi_ChannelConfigPtr[Channel].NoOfDataElements; BufferIdx++)
+        {
+            if (Spi_ConfigPtr->Spi_ChannelConfigPtr[Channel].SpiDataWidth == SPI_DFF_MODE_16Bit)
+            {
+                Spi_IB[Channel][BufferIdx] = Spi_ConfigPtr->Spi_ChannelConfigPtr[Channel].SpiDefaultData;
+            }
+            else
+            {
+                SPI_IB_BUFFER(Channel)[BufferIdx] = Spi_ConfigPtr->Spi_ChannelConfigPtr[Channel].SpiDefaultData;
+            }
+        }
+    }
+    else
+    {
+        // Store data in internal buffer
+        for (BufferIdx = 0; BufferIdx < SPI_IB_BYTES(Channel); BufferIdx++)
+        {
+            SPI_IB_BUFFER(Channel)[BufferIdx] = DataBufferPtr[BufferIdx];
+        }
+    }
+    return;
+}
+
+#ifdef SpiDevErrorDetect
+/**
+* @name : Spi_StaticCheckIBConfig
+* @param: ConfigPtr: configuration set
+* @Return: E_NOT_OK: an IB channel has more than SpiIbNBuffers elements
+**/
+static Std_ReturnType Spi_StaticCheckIBConfig(const Spi_ConfigType *ConfigPtr)
+{
+    uint8 ChIdx = 0;
+
+    for (ChIdx = 0; ChIdx < ConfigPtr->NoOfChannels && ChIdx < SpiMaxChannel; ChIdx++)
+    {
+        if (ConfigPtr->Spi_ChannelConfigPtr[ChIdx].ChannelType == SpiChannelBufferIB &&
+            ConfigPtr->Spi_ChannelConfigPtr[ChIdx].NoOfDataElements > SpiIbNBuffers)
+        {
+            return E_NOT_OK;
+        }
+    }
+    return E_OK;
+}
+#endif
+#endif
+
+/**
+ * name : Dio_WriteChannel
+ * param: ChannelId: ID of DIO channel 
+ *            Level: Value to be written
+ * Reentrancy: Reentrant
+ * Sync
+ * Description: Service to set a level of a channel.
+ **/
+static void Dio_WriteChannel(Spi_CS_Pin ChannelId, Std_ReturnType Level)
+{
+    if (ChannelId >= PORTA_CHANNEL_OFFEST && ChannelId < PORTx_CHANNEL_OFFSET)
+    {
+        // OK proceed
+        /* 
+        * USE BSRR and BRR registers to provide atomic channel access 
+        */
+        if (ChannelId >= PORTA_CHANNEL_OFFEST &&
+            ChannelId < PORTB_CHANNEL_OFFEST)
+        {
+            switch (Level)
+            {
+            case STD_HIGH:
+                SET_BIT(GPIOA_BSRR, ChannelId); // Set Channel
+                break;
+            case STD_LOW:
+                SET_BIT(GPIOA_BRR, ChannelId); // Reset Channel
                 break;
             default:
                 // shouldn't be here
@@ -824,15 +1870,395 @@ static void Dio_WriteChannel(Spi_CS_Pin ChannelId, Std_ReturnType Level)
 /**
     * @name : Spi_StaticInitHWUnits
 		* @param: NONE
-    * @Description: initialize all HW units. 
+    * @Description: initialize all HW units according to their mode. 
 **/
 static void Spi_StaticInitHWUnits(void)
 
 {
-    // [SWS_Spi_00040] The SPI Handler/Driver handles only the Master mode.
+    switch (Spi_ConfigPtr->Spi1Mode)
+    {
+    case SPI_MASTER_MODE:
+        SET_BIT(SPI1_CR1, SPI_CR1_MSTR);
+        break;
+#ifdef SpiSlaveSupport
+    case SPI_SLAVE_MODE:
+        Spi_StaticInitSlave(&Spi_SlaveUnit[0], Spi_ConfigPtr->Spi1SlaveConfigPtr,
+                            &SPI1_CR1, &SPI1_CR2, &SPI1_DR, 2, 3);
+        break;
+#endif
+    default:
+        // Not used
+        break;
+    }
 
-    SET_BIT(SPI1_CR1, SPI_CR1_MSTR);
-    SET_BIT(SPI2_CR1, SPI_CR1_MSTR);
+    switch (Spi_ConfigPtr->Spi2Mode)
+    {
+    case SPI_MASTER_MODE:
+        SET_BIT(SPI2_CR1, SPI_CR1_MSTR);
+        break;
+#ifdef SpiSlaveSupport
+    case SPI_SLAVE_MODE:
+        Spi_StaticInitSlave(&Spi_SlaveUnit[1], Spi_ConfigPtr->Spi2SlaveConfigPtr,
+                            &SPI2_CR1, &SPI2_CR2, &SPI2_DR, 4, 5);
+        break;
+#endif
+    default:
+        // Not used
+        break;
+    }
 
     return;
 }
+
+#ifdef SpiBaudCalibrationApi
+/**
+    * @name : Spi_StaticCountBitErrors
+    * @param: ReceivedPtr, ExpectedPtr: buffers to compare
+    *         Length: number of bytes
+    * @Description: returns the number of differing bits (saturated at 255). 
+**/
+static uint8 Spi_StaticCountBitErrors(const Spi_DataBufferType *ReceivedPtr, const Spi_DataBufferType *ExpectedPtr, Spi_NumberOfDataType Length)
+{
+    uint16 BitErrors = 0;
+    Spi_NumberOfDataType idx;
+    uint8 Diff;
+
+    for (idx = 0; idx < Length; idx++)
+    {
+        // Clear the lowest set bit of the difference until none is left
+        for (Diff = ReceivedPtr[idx] ^ ExpectedPtr[idx]; Diff != 0; Diff &= (uint8)(Diff - 1))
+        {
+            BitErrors++;
+        }
+    }
+    return (BitErrors > 0xFF) ? 0xFF : (uint8)BitErrors;
+}
+#endif
+
+#ifdef SpiTransferProgramApi
+/**
+    * @name : Spi_StaticExchange
+    * @param: TransmitPtr: unit registers
+    *         TxData: frame to send
+    * @Description: full-duplex exchange of one 8 bit frame, returns the received frame. 
+**/
+static uint8 Spi_StaticExchange(volatile TransmitionType *TransmitPtr, uint8 TxData)
+{
+    while (GET_BIT(*(TransmitPtr->SPI_SR), SPI_SR_TXE) == 0)
+        ;
+    *(TransmitPtr->SPI_DR) = TxData;
+    while (GET_BIT(*(TransmitPtr->SPI_SR), SPI_SR_RXNE) == 0)
+        ;
+    return (uint8)(*(TransmitPtr->SPI_DR));
+}
+
+/**
+    * @name : Spi_StaticOperandBytes
+    * @param: ProgramPtr: program
+    *         Pc: index following the opcode
+    *         ProgramLength: program size
+    *         OpCode: opcode
+    * @Description: returns the number of operand bytes following the opcode. 
+**/
+static uint16 Spi_StaticOperandBytes(const uint8 *ProgramPtr, uint16 Pc, uint16 ProgramLength, uint8 OpCode)
+{
+    uint16 Bytes = 0;
+
+    switch (OpCode)
+    {
+    case SPI_OP_TX_INLINE:
+        // n, n data bytes (n itself missing: reported as one byte too many)
+        Bytes = (Pc < ProgramLength) ? (uint16)(1U + ProgramPtr[Pc]) : 1U;
+        break;
+    case SPI_OP_TX_BUFFER:
+    case SPI_OP_RX_BUFFER:
+        Bytes = 2U;
+        break;
+    case SPI_OP_POLL:
+        Bytes = 5U;
+        break;
+    case SPI_OP_LOOP:
+        Bytes = 1U;
+        break;
+    default:
+        break;
+    }
+    return Bytes;
+}
+
+/**
+    * @name : Spi_StaticSkipLoop
+    * @param: ProgramPtr: program
+    *         Pc: first opcode of the loop body
+    *         ProgramLength: program size
+    * @Description: returns the index following the SPI_OP_END_LOOP closing the loop 
+    *               (used for a zero count), ProgramLength if the loop is not closed. 
+**/
+static uint16 Spi_StaticSkipLoop(const uint8 *ProgramPtr, uint16 Pc, uint16 ProgramLength)
+{
+    uint8 Depth = 1;
+    uint8 OpCode;
+
+    while (Depth != 0)
+    {
+        if (Pc >= ProgramLength)
+        {
+            return ProgramLength;
+        }
+        OpCode = ProgramPtr[Pc++];
+        if ((uint32)Pc + Spi_StaticOperandBytes(ProgramPtr, Pc, ProgramLength, OpCode) > ProgramLength)
+        {
+            return ProgramLength;
+        }
+        Pc += Spi_StaticOperandBytes(ProgramPtr, Pc, ProgramLength, OpCode);
+        switch (OpCode)
+        {
+        case SPI_OP_LOOP:
+        case SPI_OP_LOOP_LAST_RX:
+            Depth++;
+            break;
+        case SPI_OP_END_LOOP:
+            Depth--;
+            break;
+        case SPI_OP_END:
+            // Unterminated loop: stop on the END opcode
+            Pc--;
+            Depth = 0;
+            break;
+        default:
+            break;
+        }
+    }
+    return Pc;
+}
+#endif
+
+/**
+    * @name : Spi_StaticGetUnitMode
+    * @param: HWUnit: SPI1_HW_UNIT / SPI2_HW_UNIT
+    * @Description: returns the configured mode of the HW unit. 
+**/
+static Spi_ModeType Spi_StaticGetUnitMode(Spi_HWunitType HWUnit)
+{
+    Spi_ModeType Mode = SPI_NOTUSED_MODE;
+    switch (HWUnit)
+    {
+    case SPI1_HW_UNIT:
+        Mode = Spi_ConfigPtr->Spi1Mode;
+        break;
+    case SPI2_HW_UNIT:
+        Mode = Spi_ConfigPtr->Spi2Mode;
+        break;
+    default:
+        // Shouldn't be here
+        break;
+    }
+    return Mode;
+}
+
+#ifdef SpiSlaveSupport
+/**
+    * @name : Spi_StaticInitSlave
+    * @param: UnitPtr: Run time data of the unit
+    *         SlaveConfigPtr: Slave configuration
+    *         SPI_CR1, SPI_CR2, SPI_DR: Unit registers
+    *         RxDmaChannel, TxDmaChannel: DMA1 channels mapped to the unit
+    * @Description: Configures the unit as slave with hardware NSS and starts 
+    *               the circular reception into the ring. 
+**/
+static void Spi_StaticInitSlave(Spi_SlaveUnitType *UnitPtr, const Spi_SlaveConfigType *SlaveConfigPtr,
+                                volatile uint32 *SPI_CR1, volatile uint32 *SPI_CR2, volatile uint32 *SPI_DR,
+                                uint8 RxDmaChannel, uint8 TxDmaChannel)
+{
+    UnitPtr->ConfigPtr = SlaveConfigPtr;
+    UnitPtr->SPI_DR = SPI_DR;
+    UnitPtr->RxLaps = 0;
+    UnitPtr->RxConsumed = 0;
+    UnitPtr->OverrunCount = 0;
+    UnitPtr->RxDmaChannel = RxDmaChannel;
+    UnitPtr->TxDmaChannel = TxDmaChannel;
+
+    // Frame format must be set with the unit disabled
+    CLR_BIT(*SPI_CR1, SPI_CR1_SPE);
+    CLR_BIT(*SPI_CR1, SPI_CR1_MSTR);
+    CLR_BIT(*SPI_CR1, SPI_CR1_SSM);     // NSS driven by the master
+    CLR_BIT(*SPI_CR1, SPI_CR1_DFF);
+
+    if (SlaveConfigPtr->SpiClkPol == SPI_CLK_POL_HIGH)
+    {
+        SET_BIT(*SPI_CR1, SPI_CR1_CPOL);
+    }
+    else
+    {
+        CLR_BIT(*SPI_CR1, SPI_CR1_CPOL);
+    }
+
+    if (SlaveConfigPtr->SpiClkPhase == SPI_CLK_PHASE_SECOND)
+    {
+        SET_BIT(*SPI_CR1, SPI_CR1_CPHA);
+    }
+    else
+    {
+        CLR_BIT(*SPI_CR1, SPI_CR1_CPHA);
+    }
+
+    if (SlaveConfigPtr->SpiTransferStart == SPI_LSB_FIRST)
+    {
+        SET_BIT(*SPI_CR1, SPI_CR1_LSBF);
+    }
+    else
+    {
+        CLR_BIT(*SPI_CR1, SPI_CR1_LSBF);
+    }
+
+    // RX: peripheral to memory, 8 bit, circular over the ring, high priority
+    CLR_BIT(DMA1_CCR(RxDmaChannel), DMA_CCR_EN);
+    DMA1_IFCR = (0x0FUL << DMA_ISR_GIF(RxDmaChannel));
+    DMA1_CCR(RxDmaChannel) = (1UL << DMA_CCR_MINC) | (1UL << DMA_CCR_CIRC) |
+                             (1UL << DMA_CCR_TCIE) | (2UL << DMA_CCR_PL0);
+    DMA1_CPAR(RxDmaChannel) = (uint32)SPI_DR;
+    DMA1_CMAR(RxDmaChannel) = (uint32)SlaveConfigPtr->SpiRxRingPtr;
+    DMA1_CNDTR(RxDmaChannel) = SlaveConfigPtr->SpiRxRingSize;
+    SET_BIT(DMA1_CCR(RxDmaChannel), DMA_CCR_EN);
+
+    // TX: armed by Spi_SlaveSetReply
+    CLR_BIT(DMA1_CCR(TxDmaChannel), DMA_CCR_EN);
+    DMA1_IFCR = (0x0FUL << DMA_ISR_GIF(TxDmaChannel));
+
+    NVIC_ISER0 = (1UL << (NVIC_IRQ_DMA1_CH1 - 1 + RxDmaChannel));
+    NVIC_ISER0 = (1UL << (NVIC_IRQ_DMA1_CH1 - 1 + TxDmaChannel));
+
+    // RX DMA request must be enabled before the unit
+    SET_BIT(*SPI_CR2, SPI_CR2_RXDMAEN);
+    SET_BIT(*SPI_CR2, SPI_CR2_TXDMAEN);
+    SET_BIT(*SPI_CR1, SPI_CR1_SPE);
+}
+
+/**
+    * @name : Spi_StaticGetSlaveUnit
+    * @param: HWUnit: SPI1_HW_UNIT / SPI2_HW_UNIT
+    *         ApiId: API reporting the DET error
+    * @Description: returns the run time data of the unit or NULL_PTR if the unit 
+    *               isn't a slave. 
+**/
+static Spi_SlaveUnitType *Spi_StaticGetSlaveUnit(Spi_HWunitType HWUnit, uint8 ApiId)
+{
+    Spi_SlaveUnitType *UnitPtr = NULL_PTR;
+
+    if (Spi_ConfigPtr == NULL_PTR)
+    {
+#ifdef SpiDevErrorDetect
+        Det_ReportError(SPI_ModuleId, 0, ApiId, SPI_E_UNINIT);
+#endif
+    }
+    else if (Spi_StaticGetUnitMode(HWUnit) != SPI_SLAVE_MODE)
+    {
+#ifdef SpiDevErrorDetect
+        Det_ReportError(SPI_ModuleId, 0, ApiId, SPI_E_PARAM_UNIT);
+#endif
+    }
+    else
+    {
+        UnitPtr = &Spi_SlaveUnit[HWUnit - SPI1_HW_UNIT];
+    }
+    return UnitPtr;
+}
+
+#ifdef SpiDevErrorDetect
+/**
+    * @name : Spi_StaticCheckSlaveConfig
+    * @param: Mode: configured mode of the unit
+    *         SlaveConfigPtr: slave configuration of the unit
+    * @Return: 0 if the unit is not a slave or its ring is usable, else the DET error:
+    *          SPI_E_PARAM_POINTER: no configuration or no ring
+    *          SPI_E_PARAM_LENGTH: ring size 0 (CNDTR = 0 stops the DMA) or not a power
+    *                              of 2 (byte counters no longer match the ring index on wrap)
+**/
+static uint8 Spi_StaticCheckSlaveConfig(Spi_ModeType Mode, const Spi_SlaveConfigType *SlaveConfigPtr)
+{
+    if (Mode != SPI_SLAVE_MODE)
+    {
+        return 0;
+    }
+    if (SlaveConfigPtr == NULL_PTR || SlaveConfigPtr->SpiRxRingPtr == NULL_PTR)
+    {
+        return SPI_E_PARAM_POINTER;
+    }
+    if (SlaveConfigPtr->SpiRxRingSize == 0U ||
+        (SlaveConfigPtr->SpiRxRingSize & (SlaveConfigPtr->SpiRxRingSize - 1U)) != 0U)
+    {
+        return SPI_E_PARAM_LENGTH;
+    }
+    return 0;
+}
+#endif
+
+/**
+    * @name : Spi_StaticSlaveAvailable
+    * @param: UnitPtr: Run time data of the unit
+    * @Description: returns the bytes not consumed yet. Bytes the DMA already 
+    *               overwrote are dropped and counted as overrun.
+**/
+static Spi_NumberOfDataType Spi_StaticSlaveAvailable(Spi_SlaveUnitType *UnitPtr)
+{
+    uint32 Laps;
+    uint32 Remaining;
+    uint32 TcPending;
+    uint32 Available;
+    uint32 RingSize = UnitPtr->ConfigPtr->SpiRxRingSize;
+
+    /* Laps and CNDTR can't be read atomically: RxLaps is read before and after
+       them, a different value means the TC interrupt ran in between */
+    do
+    {
+        Laps = UnitPtr->RxLaps;
+        Remaining = DMA1_CNDTR(UnitPtr->RxDmaChannel);
+        TcPending = GET_BIT(DMA1_ISR, DMA_ISR_TCIF(UnitPtr->RxDmaChannel));
+    } while (Laps != UnitPtr->RxLaps);
+
+    /* CNDTR reloaded but TC not served yet (interrupt masked, or called from a
+       higher priority ISR): the lap is not counted in RxLaps yet */
+    if (TcPending != 0 && Remaining > (RingSize / 2))
+    {
+        Laps++;
+    }
+
+    Available = ((Laps * RingSize) + (RingSize - Remaining)) - UnitPtr->RxConsumed;
+    if (Available > RingSize)
+    {
+        UnitPtr->OverrunCount += Available - RingSize;
+        UnitPtr->RxConsumed += Available - RingSize;
+        Available = RingSize;
+    }
+    return (Spi_NumberOfDataType)Available;
+}
+
+/**
+    * @name : Spi_StaticSlaveRxIsr
+    * @param: UnitPtr: Run time data of the unit
+    * @Description: RX DMA transfer complete, the ring wrapped. 
+**/
+static void Spi_StaticSlaveRxIsr(Spi_SlaveUnitType *UnitPtr)
+{
+    if (GET_BIT(DMA1_ISR, DMA_ISR_TCIF(UnitPtr->RxDmaChannel)) != 0)
+    {
+        DMA1_IFCR = (1UL << DMA_ISR_TCIF(UnitPtr->RxDmaChannel));
+        UnitPtr->RxLaps++;
+    }
+}
+
+/**
+    * @name : Spi_StaticSlaveTxIsr
+    * @param: UnitPtr: Run time data of the unit
+    * @Description: Last reply byte moved to the TX buffer, the channel is free 
+    *               for the next Spi_SlaveSetReply. 
+**/
+static void Spi_StaticSlaveTxIsr(Spi_SlaveUnitType *UnitPtr)
+{
+    if (GET_BIT(DMA1_ISR, DMA_ISR_TCIF(UnitPtr->TxDmaChannel)) != 0)
+    {
+        DMA1_IFCR = (1UL << DMA_ISR_TCIF(UnitPtr->TxDmaChannel));
+        CLR_BIT(DMA1_CCR(UnitPtr->TxDmaChannel), DMA_CCR_EN);
+    }
+}
+#endif
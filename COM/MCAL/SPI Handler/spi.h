@@ -113,6 +113,13 @@
 /* Master Slave Selection */
 #define SPI_MASTER_MODE                 1U
 #define SPI_NOTUSED_MODE                0U
+#define SPI_SLAVE_MODE                  2U      // Receive ring + reply buffer, see Spi_SlaveXxx APIs
+
+/* Chip select handling */
+#define SPI_CS_VIA_GPIO                 0U      // SpiCSPin toggled by the driver around the job
+#define SPI_CS_VIA_PERIPHERAL_ENGINE    1U      // NSS handled by the SPI HW unit
+#define SPI_CS_VIA_USER                 2U      // CS untouched, held by the upper layer over several jobs
+#define SPI_CS_VIA_DECODER              3U      // SpiCsDecoderAddress selected on the CS decoder (SpiCsDecoderSupport)
 
 /* Clk Polarity & phase  for either master or slave*/
 /*
@@ -140,6 +147,12 @@
 #define SPI_DFF_MODE_8Bit               0U
 #define SPI_DFF_MODE_16Bit              1U
 
+/* Channel data direction (master units) */
+#define SPI_DIRECTION_FULL_DUPLEX       0U      // 2 lines, every frame sent and received
+#define SPI_DIRECTION_RX_ONLY           1U      // 2 lines, RXONLY: MOSI free, nothing written to DR
+#define SPI_DIRECTION_BIDI_TX           2U      // 1 line (3-wire), BIDIOE = 1: MOSI drives the data line
+#define SPI_DIRECTION_BIDI_RX           3U      // 1 line (3-wire), BIDIOE = 0: MOSI reads the data line
+
 // Baud Rate 
 #define SPI_BAUD_RATE_CLK_DIV2       0U
 #define SPI_BAUD_RATE_CLK_DIV4       1U
@@ -150,6 +163,44 @@
 #define SPI_BAUD_RATE_CLK_DIV128     6U
 #define SPI_BAUD_RATE_CLK_DIV256     7U
 
+/* Transfer program opcodes, see Spi_RunProgram
+   A program is a uint8 array built with the SPI_PROG_xx macros below, 8 bit frames, 
+   MSB first, clocked with the settings of the job given to Spi_RunProgram.
+   Programs run synchronously in the calling task (not from interrupts), the
+   program size is passed so a missing SPI_PROG_END can't run past the array.
+   Example, drain a sensor FIFO whose level is read from register 0x3A:
+    static const uint8 DrainFifo[] = {
+        SPI_PROG_CS_ASSERT(), SPI_PROG_TX2(0x80 | 0x3A, 0x00), SPI_PROG_CS_RELEASE(),
+        SPI_PROG_LOOP_LAST_RX(),
+            SPI_PROG_CS_ASSERT(), SPI_PROG_TX1(0x80 | 0x3B), SPI_PROG_RX_BUFFER(0, 6), SPI_PROG_CS_RELEASE(),
+        SPI_PROG_END_LOOP(),
+        SPI_PROG_END()
+    };
+*/
+#define SPI_OP_END                  0x00U
+#define SPI_OP_CS_ASSERT            0x01U
+#define SPI_OP_CS_RELEASE           0x02U
+#define SPI_OP_TX_INLINE            0x03U   // n, n data bytes
+#define SPI_OP_TX_BUFFER            0x04U   // buffer index, n: send n bytes from the buffer cursor
+#define SPI_OP_RX_BUFFER            0x05U   // buffer index, n: receive n bytes at the buffer cursor
+#define SPI_OP_POLL                 0x06U   // tx, mask, value, tries 1 ~ 65535 (LSB, MSB): until (rx & mask) == value
+#define SPI_OP_LOOP                 0x07U   // count: body up to SPI_OP_END_LOOP runs count times
+#define SPI_OP_LOOP_LAST_RX         0x08U   // as SPI_OP_LOOP, count = last received byte
+#define SPI_OP_END_LOOP             0x09U
+
+#define SPI_PROG_END()                          SPI_OP_END
+#define SPI_PROG_CS_ASSERT()                    SPI_OP_CS_ASSERT
+#define SPI_PROG_CS_RELEASE()                   SPI_OP_CS_RELEASE
+#define SPI_PROG_TX_INLINE(n)                   SPI_OP_TX_INLINE, (uint8)(n)
+#define SPI_PROG_TX1(b0)                        SPI_OP_TX_INLINE, 1U, (uint8)(b0)
+#define SPI_PROG_TX2(b0, b1)                    SPI_OP_TX_INLINE, 2U, (uint8)(b0), (uint8)(b1)
+#define SPI_PROG_TX_BUFFER(buf, n)              SPI_OP_TX_BUFFER, (uint8)(buf), (uint8)(n)
+#define SPI_PROG_RX_BUFFER(buf, n)              SPI_OP_RX_BUFFER, (uint8)(buf), (uint8)(n)
+#define SPI_PROG_POLL(tx, mask, value, tries)   SPI_OP_POLL, (uint8)(tx), (uint8)(mask), (uint8)(value), (uint8)(tries), (uint8)((tries) >> 8)
+#define SPI_PROG_LOOP(count)                    SPI_OP_LOOP, (uint8)(count)
+#define SPI_PROG_LOOP_LAST_RX()                 SPI_OP_LOOP_LAST_RX
+#define SPI_PROG_END_LOOP()                     SPI_OP_END_LOOP
+
 // Piriority 
 #define SPi_JobPiriority0           0U
 #define SPi_JobPiriority1           1U
@@ -161,7 +212,7 @@
 /*                            Type Definitons                           */
 /************************************************************************/
 
-// SPI_MASTER_MODE / SPI_SLAVE_MODE
+// SPI_NOTUSED_MODE / SPI_MASTER_MODE / SPI_SLAVE_MODE
 typedef uint8 Spi_ModeType;
 
 // SPI_CLK_POL_LOW / SPI_CLK_POL_HIGH
@@ -176,6 +227,9 @@ typedef uint8 Spi_DffType;
 // SPI_LSB_FIRST / SPI_LSB_LAST
 typedef boolean SpiTransferStartType; 
 
+// SPI_DIRECTION_xx
+typedef uint8 Spi_DirectionType;
+
 // SPIBAUD_RATE_CLK_DIVx
 typedef uint8 Spi_BaudRateType; 
 
@@ -185,6 +239,9 @@ typedef uint8 Spi_HWunitType;
 // DIO_CHANNEL_xx
 typedef uint8 Spi_CS_Pin;
 
+// SPI_CS_VIA_GPIO / SPI_CS_VIA_PERIPHERAL_ENGINE / SPI_CS_VIA_USER
+typedef uint8 Spi_CsSelectionType;
+
 // Range : SPi_JobPiriority0 (lowest) to SPi_JobPiriority3 (Highest) 
 typedef uint8 Spi_JobPiriority; 
 
@@ -243,13 +300,22 @@ typedef struct
 {
     // channel config 
     Spi_ChannelType SpiChannelId; 
-    Spi_DffType SpiDataWidth;                       // DFF_MODE_8Bit / DFF_MODE_16Bit
+    /* DFF_MODE_8Bit / DFF_MODE_16Bit
+       16 bit: one half-word aligned uint16 per element, Length counts frames */
+    Spi_DffType SpiDataWidth;
     SpiTransferStartType SpiTransferStart;          // LSB_FIRST / LSB_LAST
 		uint8 ChannelType;                               // Specify EB/IB type      
 		/* For IB - contains number of IB data elements,
     For EB - contains maximum data elements          */
 		uint16 NoOfDataElements;
     Spi_DataBufferType SpiDefaultData;                          // default Transmit Value
+    /* SPI_DIRECTION_xx
+       RX only / BIDI_RX: source buffer and default data are not used
+       BIDI_TX: nothing is received, destination buffer is not written */
+    Spi_DirectionType SpiChannelDirection;
+    /* TRUE: 8-bit full-duplex channel streamed as 16-bit frames (half the DR accesses),
+       odd length ends with one 8-bit frame. The wire format is unchanged. */
+    boolean SpiFramePacking;
 }Spi_ChannelConfigType;
 
 typedef struct 
@@ -263,7 +329,8 @@ typedef struct
     Spi_ClkPhaseType SpiClkPhase;                   // SPI_CLK_PHASE_FIRST / SPI_CLK_PHASE_SECOND
     Spi_BaudRateType SpiBaudRate;                   // SPIBAUD_RATE_CLK_DIVx
     Spi_CS_Pin SpiCSPin;                            // DIO_CHANNEL_xx
-    boolean SpiCsOn;                                // TRUE = Chip Select Functionality ON (HW handling)
+    Spi_CsSelectionType SpiCsSelection;             // SPI_CS_VIA_GPIO / SPI_CS_VIA_PERIPHERAL_ENGINE / SPI_CS_VIA_USER / SPI_CS_VIA_DECODER
+    uint8 SpiCsDecoderAddress;                      // SPI_CS_VIA_DECODER: decoder output of the slave (0 ~ 7 for a 74HC138)
  //   void (*SpiEndJobNotification_ptr)(void);        // Ptr to call back function       
 }Spi_JobConfigType;
 
@@ -274,14 +341,42 @@ typedef struct
     Spi_SequenceType SpiSeqId;                      // Sequence ID used with APIs
 }Spi_SeqConfigType;
 
+/* Slave HW unit configuration
+   The master owns the clock and NSS (hardware NSS input, PA4 / PB12).
+   Reception runs by DMA into the ring in circular mode, no CPU work per byte. 
+   The transmit side sends the reply set by Spi_SlaveSetReply; with no reply
+   pending the unit repeats the last byte of the previous reply.
+*/
+typedef struct
+{
+    Spi_DataBufferType *SpiRxRingPtr;               // Receive ring written by DMA, not NULL
+    Spi_NumberOfDataType SpiRxRingSize;             // Ring size in bytes, power of 2 (checked by Spi_Init)
+    Spi_ClkPolType SpiClkPol;                       // Must match the master
+    Spi_ClkPhaseType SpiClkPhase;                   // Must match the master
+    SpiTransferStartType SpiTransferStart;          // LSB_FIRST / LSB_LAST
+}Spi_SlaveConfigType;
+
+/* Data buffer used by a transfer program (SPI_PROG_TX_BUFFER / SPI_PROG_RX_BUFFER)
+   Cursor is reset by Spi_RunProgram, it returns the number of bytes used. */
+typedef struct
+{
+    Spi_DataBufferType *DataPtr;
+    Spi_NumberOfDataType Size;
+    Spi_NumberOfDataType Cursor;
+}Spi_ProgramBufferType;
+
 typedef struct Spi_ConfigType
 {
-		// The SPI Handler/Driver only supports full-duplex mode
+		// Data direction is selected per channel (SpiChannelDirection)
 
-		// MODE: SPI_NOTUSED_MODE / SPI_MASTER_MODE
-		// [SWS_Spi_00040] The SPI Handler/Driver handles only the Master mode.
+		// MODE: SPI_NOTUSED_MODE / SPI_MASTER_MODE / SPI_SLAVE_MODE
+		// Jobs and sequences are only handled on master units.
     Spi_ModeType Spi1Mode;
 		Spi_ModeType Spi2Mode;	
+
+    // Used for units in SPI_SLAVE_MODE only
+    const Spi_SlaveConfigType * Spi1SlaveConfigPtr;
+    const Spi_SlaveConfigType * Spi2SlaveConfigPtr;
     
 		// Number of Jobs configured 
      Spi_JobType NoOfJobs;
@@ -332,6 +427,26 @@ Std_ReturnType Spi_SyncTransmit( Spi_SequenceType Sequence );
 
 Spi_StatusType Spi_GetHWUnitStatus( Spi_HWunitType HWUnit );
 
+#ifdef SpiBaudCalibrationApi
+Std_ReturnType Spi_CalibrateBaudRate( Spi_SequenceType Sequence, Spi_ChannelType Channel, const Spi_DataBufferType* PatternPtr, const Spi_DataBufferType* ExpectedPtr, Spi_NumberOfDataType Length, uint8 Repetitions, Spi_BaudRateType* SelectedPtr );
+#endif
+
+#ifdef SpiTransferProgramApi
+Std_ReturnType Spi_RunProgram( Spi_JobType Job, const uint8* ProgramPtr, uint16 ProgramLength, Spi_ProgramBufferType* BuffersPtr, uint8 NoOfBuffers );
+#endif
+
+#ifdef SpiSlaveSupport
+Spi_NumberOfDataType Spi_SlaveGetAvailable( Spi_HWunitType HWUnit );
+
+Spi_NumberOfDataType Spi_SlaveRead( Spi_HWunitType HWUnit, Spi_DataBufferType* DataBufferPtr, Spi_NumberOfDataType Length );
+
+Std_ReturnType Spi_SlaveConsume( Spi_HWunitType HWUnit, Spi_NumberOfDataType Length );
+
+Std_ReturnType Spi_SlaveSetReply( Spi_HWunitType HWUnit, const Spi_DataBufferType* ReplyPtr, Spi_NumberOfDataType Length );
+
+uint32 Spi_SlaveGetOverrunCount( Spi_HWunitType HWUnit );
+#endif
+
 // void Spi_Cancel( Spi_SequenceType Sequence );
 
 // Std_ReturnType Spi_SetAsyncMode( Spi_AsyncModeType Mode );
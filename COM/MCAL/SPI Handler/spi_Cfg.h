@@ -8,6 +8,7 @@
 #ifndef SPI_CFG_H
 #define SPI_CFG_H
 
+#include "DIO_cfg.h"
 
 // SPI GENERAL Container 
 
@@ -55,6 +56,46 @@
 */
 #define SpiUserCallbackHeaderFile       "PATH.h"
 
+/*  Core (HCLK) cycles per PCLK cycle of each unit: SPI1 on APB2, SPI2 on APB1.
+    One SCK is 2^(BR+1) PCLK cycles; the receive only stop sequence waits one
+    SCK on the DWT cycle counter.
+*/
+#define SpiApb2ClockRatio           1U
+#define SpiApb1ClockRatio           2U
+
+/*  Switches the slave mode support ON or OFF.
+    Adds the Spi_SlaveXxx APIs and the DMA1 channel ISRs of the slave units
+    (SPI1: channels 2 / 3, SPI2: channels 4 / 5).
+*/
+#define SpiSlaveSupport
+
+/*  Chip select decoder (74HC138) used by SPI_CS_VIA_DECODER jobs.
+    Address lines: adjoining channels of one port, same layout as Dio_ChannelGroupType 
+    (mask positioned on the port). The address is written in one BSRR store.
+    Enable line (G2A, active low) strobes the selected output after the address settled.
+*/
+#define SpiCsDecoderSupport
+#define SpiCsDecoderPort            DIO_PORTTYPE_PORTB
+#define SpiCsDecoderMask            (0x00E0UL)          // PB5 ~ PB7 -> A0 ~ A2
+#define SpiCsDecoderOffset          (5U)
+#define SpiCsDecoderEnableChannel   DIO_CHANNEL_B4
+
+/*  Switches the Spi_CalibrateBaudRate function ON or OFF.
+    SpiCalibrationMaxLength: longest test pattern (bytes)
+    SpiCalibrationMarginSteps: prescaler steps kept below the fastest error free setting
+*/
+#define SpiBaudCalibrationApi
+#define SpiCalibrationMaxLength     32U
+#define SpiCalibrationMarginSteps   1U
+
+/*  Switches the Spi_RunProgram function (transfer programs) ON or OFF.
+    SpiProgramMaxNesting: nested SPI_PROG_LOOP levels
+    SpiProgramFillByte: sent while receiving into a buffer
+*/
+#define SpiTransferProgramApi
+#define SpiProgramMaxNesting        2U
+#define SpiProgramFillByte          0xFFU
+
 // Switches the Spi_GetVersionInfo function ON or OFF.
 #define SpiVersionInfoApi								TRUE
 
@@ -81,23 +122,40 @@
 // SpiChannel Container 
 
 //the maximum size (number of data elements) of data buffers in case of EB Channels.
-#define SpiEbMaxLength      10U
+// Must hold one flash page (Fls page program data channel)
+#define SpiEbMaxLength      256U
 
 // the maximum number of data buffers in case of IB Channels and only.
+// Upper limit of NoOfDataElements of an IB channel (8 or 16 bit), checked by Spi_Init.
 #define SpiIbNBuffers       30U
 
 // Spi Driver Container
 
 // No. of configured channels 
 // Range: 0 - 255
-#define SpiMaxChannel       3U
+// Channels 3, 4 are used by the external flash driver (Fls_Cfg.h)
+// Channel 5 is used by the SD card driver (Sd_Cfg.h)
+// Channels 6, 7 are used by the TFT display (Tft_Cfg.h)
+// Channel 8 is used by the I/O expander (IoExp_Cfg.h)
+// Channel 9 is used by the inter-MCU link (SpiLink_Cfg.h)
+#define SpiMaxChannel       10U
 
 // No. of configured jobs 
 // Range: 0 - 65535
-#define SpiMaxJob           2U
+// Jobs 2, 3 are used by the external flash driver (Fls_Cfg.h)
+// Jobs 4, 5 are used by the SD card driver (Sd_Cfg.h)
+// Jobs 6, 7 are used by the TFT display (Tft_Cfg.h)
+// Job 8 is used by the I/O expander (IoExp_Cfg.h)
+// Job 9 is used by the inter-MCU link (SpiLink_Cfg.h)
+#define SpiMaxJob           10U
 
 // No. of configured sequnces 
 // Range: 0 - 255
-#define SpiMaxSequence       2U
+// Sequences 2, 3 are used by the external flash driver (Fls_Cfg.h)
+// Sequences 4, 5 are used by the SD card driver (Sd_Cfg.h)
+// Sequences 6, 7 are used by the TFT display (Tft_Cfg.h)
+// Sequence 8 is used by the I/O expander (IoExp_Cfg.h)
+// Sequence 9 is used by the inter-MCU link (SpiLink_Cfg.h)
+#define SpiMaxSequence       10U
 
 #endif
@@ -36,6 +36,16 @@
 */
 #define FUNC(rettype, memclass) rettype
 
+/* Compiler intrinsics */
+#ifdef ARMGCC_C_STM32F103C8
+/* Index of the lowest set bit (CTZ: count trailing zeros), x must not be 0 */
+#define CTZ(x)            __builtin_ctz(x)
+/* Number of set bits */
+#define POPCOUNT(x)       __builtin_popcount(x)
+/* Non zero if x is known to be constant at compile time */
+#define CONSTANT_P(x)     __builtin_constant_p(x)
+#endif
+
 
 
 #endif
\ No newline at end of file
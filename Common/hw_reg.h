@@ -35,12 +35,36 @@
 #define GPIOC_BRR           *((volatile uint32 *) 0x40011014)
 #define GPIOC_LCKR          *((volatile uint32 *) 0x40011018)
 
+/******************* Port address from port number ****************/
+/* Port x base = GPIOA_BASE + x * GPIO_PORT_STRIDE, x: 0 = A, 1 = B, 2 = C */
+#ifndef GPIOA_BASE
+#define GPIOA_BASE          (0x40010800UL)
+#endif
+#define GPIO_PORT_STRIDE    (0x400UL)
+#define GPIO_IDR_OFFSET     (0x08UL)
+#define GPIO_ODR_OFFSET     (0x0CUL)
+#define GPIO_BSRR_OFFSET    (0x10UL)
+
+/******************* Peripheral bit-band ****************/
+/* Every bit of 0x40000000 ~ 0x400FFFFF has a 32 bit alias word:
+   alias = PERIPH_BB_BASE + (ADDR - PERIPH_BASE) * 32 + BIT * 4
+   bit 0 of the alias reads / writes that single bit.
+   The bases can be redefined (with GPIOA_BASE) to map the registers elsewhere.
+*/
+#ifndef PERIPH_BASE
+#define PERIPH_BASE         (0x40000000UL)
+#endif
+#ifndef PERIPH_BB_BASE
+#define PERIPH_BB_BASE      (0x42000000UL)
+#endif
+
+#define BITBAND_PERIPH(ADDR, BIT)   (PERIPH_BB_BASE + (((ADDR) - PERIPH_BASE) * 32UL) + ((BIT) * 4UL))
 
 /************************* SPI *************************/
 
-#define SPI1_BASE           *((volatile uint32 *) 0x40013000)
-#define SPI2_BASE           *((volatile uint32 *) 0x40003800)
-#define SPI3_BASE           *((volatile uint32 *) 0x40013C00)
+#define SPI1_BASE           (0x40013000UL)
+#define SPI2_BASE           (0x40003800UL)
+#define SPI3_BASE           (0x40013C00UL)
 
 /********** Registers offsets ****************/
 #define SPI_CR1_OFFSET          0x00
@@ -114,4 +138,154 @@
 #define SPI_SR_OVR          6
 #define SPI_SR_BSY          7
 
+
+/********************* TIM2 ~ TIM4 *********************/
+/* General purpose timers on APB1, clocked at 2 x PCLK1 (72 MHz) */
+#define TIM2_BASE           (0x40000000UL)
+#define TIM3_BASE           (0x40000400UL)
+#define TIM4_BASE           (0x40000800UL)
+
+/********** Registers offsets ****************/
+#define TIM_CR1_OFFSET          0x00
+#define TIM_CR2_OFFSET          0x04
+#define TIM_SMCR_OFFSET         0x08
+#define TIM_DIER_OFFSET         0x0C
+#define TIM_SR_OFFSET           0x10
+#define TIM_EGR_OFFSET          0x14
+#define TIM_CCMR1_OFFSET        0x18
+#define TIM_CCMR2_OFFSET        0x1C
+#define TIM_CCER_OFFSET         0x20
+#define TIM_CNT_OFFSET          0x24
+#define TIM_PSC_OFFSET          0x28
+#define TIM_ARR_OFFSET          0x2C
+#define TIM_CCR1_OFFSET         0x34
+
+/* Register of timer BASE: TIM_REG(TIM4_BASE, TIM_ARR_OFFSET) */
+#define TIM_REG(BASE, OFFSET)   *((volatile uint32 *) ((BASE) + (OFFSET)))
+
+/******** Registers Bits *************/
+
+#define TIM_CR1_CEN         0
+#define TIM_CR1_UDIS        1
+#define TIM_CR1_URS         2
+#define TIM_CR1_OPM         3
+
+#define TIM_DIER_UIE        0
+#define TIM_DIER_CC1IE      1
+#define TIM_DIER_UDE        8
+#define TIM_DIER_CC1DE      9
+
+#define TIM_SR_UIF          0
+#define TIM_SR_CC1IF        1
+
+#define TIM_EGR_UG          0
+
+
+/************************* DMA1 *************************/
+/* Request mapping (RM0008 table 78):
+    SPI1_RX -> channel 2    SPI1_TX -> channel 3
+    SPI2_RX -> channel 4    SPI2_TX -> channel 5
+    TIM3_CH1 -> channel 6   TIM4_UP -> channel 7
+*/
+#define DMA1_BASE           (0x40020000UL)
+
+#define DMA1_ISR            *((volatile uint32 *) (DMA1_BASE + 0x00))
+#define DMA1_IFCR           *((volatile uint32 *) (DMA1_BASE + 0x04))
+
+/********** Channel registers, CH = 1 ~ 7 ****************/
+#define DMA1_CCR(CH)        *((volatile uint32 *) (DMA1_BASE + 0x08 + (20 * ((CH) - 1))))
+#define DMA1_CNDTR(CH)      *((volatile uint32 *) (DMA1_BASE + 0x0C + (20 * ((CH) - 1))))
+#define DMA1_CPAR(CH)       *((volatile uint32 *) (DMA1_BASE + 0x10 + (20 * ((CH) - 1))))
+#define DMA1_CMAR(CH)       *((volatile uint32 *) (DMA1_BASE + 0x14 + (20 * ((CH) - 1))))
+
+/******** Registers Bits *************/
+
+#define DMA_CCR_EN          0
+#define DMA_CCR_TCIE        1
+#define DMA_CCR_HTIE        2
+#define DMA_CCR_TEIE        3
+#define DMA_CCR_DIR         4
+#define DMA_CCR_CIRC        5
+#define DMA_CCR_PINC        6
+#define DMA_CCR_MINC        7
+#define DMA_CCR_PSIZE0      8
+#define DMA_CCR_MSIZE0      10
+#define DMA_CCR_PL0         12
+#define DMA_CCR_MEM2MEM     14
+
+/* ISR / IFCR: 4 flags per channel */
+#define DMA_ISR_GIF(CH)     (4 * ((CH) - 1))
+#define DMA_ISR_TCIF(CH)    (4 * ((CH) - 1) + 1)
+#define DMA_ISR_HTIF(CH)    (4 * ((CH) - 1) + 2)
+#define DMA_ISR_TEIF(CH)    (4 * ((CH) - 1) + 3)
+
+
+/************************* CRC *************************/
+/* CRC-32 (poly 0x04C11DB7), one 32 bit word per DR write */
+#define CRC_BASE            (0x40023000UL)
+
+#define CRC_DR              *((volatile uint32 *) (CRC_BASE + 0x00))
+#define CRC_IDR             *((volatile uint32 *) (CRC_BASE + 0x04))
+#define CRC_CR              *((volatile uint32 *) (CRC_BASE + 0x08))
+
+#define CRC_CR_RESET        0
+
+
+/************************* AFIO *************************/
+#define AFIO_BASE           (0x40010000UL)
+
+/* EXTICR1 ~ 4, N = 0 ~ 3: 4 bits per EXTI line (4N ~ 4N+3), 0 = PA, 1 = PB, 2 = PC */
+#define AFIO_EXTICR(N)      *((volatile uint32 *) (AFIO_BASE + 0x08 + (4 * (N))))
+
+
+/************************* EXTI *************************/
+/* One bit per line, line x = pin x of the port selected in AFIO_EXTICR */
+#define EXTI_BASE           (0x40010400UL)
+
+#define EXTI_IMR            *((volatile uint32 *) (EXTI_BASE + 0x00))
+#define EXTI_EMR            *((volatile uint32 *) (EXTI_BASE + 0x04))
+#define EXTI_RTSR           *((volatile uint32 *) (EXTI_BASE + 0x08))
+#define EXTI_FTSR           *((volatile uint32 *) (EXTI_BASE + 0x0C))
+#define EXTI_SWIER          *((volatile uint32 *) (EXTI_BASE + 0x10))
+#define EXTI_PR             *((volatile uint32 *) (EXTI_BASE + 0x14))
+
+
+/************************* DWT *************************/
+/* Cycle counter, enabled with DEMCR.TRCENA then DWT_CTRL.CYCCNTENA */
+#define DEMCR               *((volatile uint32 *) 0xE000EDFC)
+#define DWT_CTRL            *((volatile uint32 *) 0xE0001000)
+#define DWT_CYCCNT          *((volatile uint32 *) 0xE0001004)
+
+#define DEMCR_TRCENA        24
+#define DWT_CTRL_CYCCNTENA  0
+
+
+/************************* SCB *************************/
+/* ICSR.VECTACTIVE != 0: running in an exception / interrupt handler */
+#define SCB_ICSR                    *((volatile uint32 *) 0xE000ED04)
+#define SCB_ICSR_VECTACTIVE_MASK    (0x1FFUL)
+
+
+/************************* NVIC *************************/
+#define NVIC_ISER0          *((volatile uint32 *) 0xE000E100)
+#define NVIC_ISER1          *((volatile uint32 *) 0xE000E104)
+#define NVIC_ICER0          *((volatile uint32 *) 0xE000E180)
+#define NVIC_ICER1          *((volatile uint32 *) 0xE000E184)
+
+/* IRQ numbers, IRQ >= 32 in ISER1 / ICER1 */
+#define NVIC_IRQ_EXTI0      6
+#define NVIC_IRQ_EXTI1      7
+#define NVIC_IRQ_EXTI2      8
+#define NVIC_IRQ_EXTI3      9
+#define NVIC_IRQ_EXTI4      10
+#define NVIC_IRQ_EXTI9_5    23
+#define NVIC_IRQ_EXTI15_10  40
+#define NVIC_IRQ_DMA1_CH1   11
+#define NVIC_IRQ_DMA1_CH2   12
+#define NVIC_IRQ_DMA1_CH3   13
+#define NVIC_IRQ_DMA1_CH4   14
+#define NVIC_IRQ_DMA1_CH5   15
+#define NVIC_IRQ_DMA1_CH6   16
+#define NVIC_IRQ_DMA1_CH7   17
+
 #endif
@@ -0,0 +1,260 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : DioEvt.c                                                 */
+/************************************************************************/
+
+#include "det.h"
+#include "hw_reg.h"
+#include "compiler.h"
+#include "DIO.h"
+#include "DioEvt.h"
+
+/************************************************************************/
+/*                          Global Constants                            */
+/************************************************************************/
+#define DioEvt_ApiID_DioEvt_ReadEvent 0x01
+#define DioEvt_ApiID_DioEvt_ScanPort 0x02
+
+#define DIOEVT_PORT_NUM 3U
+
+#if (DioEvtQueueSize == 0U) || (DioEvtQueueSize > 128U) || ((DioEvtQueueSize & (DioEvtQueueSize - 1U)) != 0U)
+#error "DioEvt: queue size must be a power of 2 (<= 128)"
+#endif
+
+#define DIOEVT_QUEUE_INDEX(Index) ((Index) & (DioEvtQueueSize - 1U))
+
+#define DIOEVT_PORT_IDR(PortNum) \
+    (*((volatile uint32 *)(GPIOA_BASE + ((uint32)(PortNum) * GPIO_PORT_STRIDE) + GPIO_IDR_OFFSET)))
+
+/************************************************************************/
+/*                          Local types                                 */
+/************************************************************************/
+typedef struct
+{
+    uint16 RisingMask;
+    uint16 FallingMask;
+} DioEvt_PortConfigType;
+
+/************************************************************************/
+/*                          Local functions                             */
+/************************************************************************/
+LOCAL_INLINE void DioEvt_StaticScan(uint8 PortNum);
+
+/************************************************************************/
+/*                         Global variables                             */
+/************************************************************************/
+static const DioEvt_PortConfigType DioEvt_PortConfig[DIOEVT_PORT_NUM] =
+{
+    {DioEventRisingMaskPortA, DioEventFallingMaskPortA},
+    {DioEventRisingMaskPortB, DioEventFallingMaskPortB},
+    {DioEventRisingMaskPortC, DioEventFallingMaskPortC}
+};
+
+static boolean DioEvt_Initialized = FALSE;
+
+// Subscribed pins of every port at the last scan
+static uint16 DioEvt_Snapshot[DIOEVT_PORT_NUM];
+
+static uint16 DioEvt_Tick = 0;
+
+/*  Event queue, DioEvt_Head is written by the producer only and DioEvt_Tail
+    by the consumer only. Both run freely and are reduced on access, so
+    the queue holds DioEvtQueueSize events.
+*/
+static volatile DioEvt_EventType DioEvt_Queue[DioEvtQueueSize];
+static volatile uint8 DioEvt_Head = 0;
+static volatile uint8 DioEvt_Tail = 0;
+
+// Events dropped on a full queue
+static volatile uint16 DioEvt_LostEvents = 0;
+
+/************************************************************************/
+/*                         APIS definitions                             */
+/************************************************************************/
+/**
+ * @name : DioEvt_Init
+ * @param: NONE
+ * Non Reentrant
+ * Sync
+ * Takes the current input levels as reference and empties the queue.
+ **/
+void DioEvt_Init(void)
+{
+    uint8 PortNum = 0;
+
+    for (PortNum = 0; PortNum < DIOEVT_PORT_NUM; PortNum++)
+    {
+        DioEvt_Snapshot[PortNum] = (uint16)(DIOEVT_PORT_IDR(PortNum) &
+                                            (DioEvt_PortConfig[PortNum].RisingMask | DioEvt_PortConfig[PortNum].FallingMask));
+    }
+    DioEvt_Tick = 0;
+    DioEvt_Head = 0;
+    DioEvt_Tail = 0;
+    DioEvt_LostEvents = 0;
+    DioEvt_Initialized = TRUE;
+    return;
+}
+
+/**
+ * @name : DioEvt_ReadEvent
+ * @param: EventPtr: oldest queued event
+ * Non Reentrant
+ * Sync
+ * @Return: E_OK: event read, E_NOT_OK: queue empty
+ **/
+Std_ReturnType DioEvt_ReadEvent(DioEvt_EventType *EventPtr)
+{
+    uint8 Tail = DioEvt_Tail;
+    volatile DioEvt_EventType *Event = NULL_PTR;
+
+#ifdef DioEvtDevErrorDetect
+    if (DioEvt_Initialized == FALSE)
+    {
+        Det_ReportError(DIOEVT_ModuleId, 0, DioEvt_ApiID_DioEvt_ReadEvent, DIOEVT_E_UNINIT);
+        return E_NOT_OK;
+    }
+    if (EventPtr == NULL_PTR)
+    {
+        Det_ReportError(DIOEVT_ModuleId, 0, DioEvt_ApiID_DioEvt_ReadEvent, DIOEVT_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+#endif
+    if (Tail == DioEvt_Head)
+    {
+        return E_NOT_OK;
+    }
+    Event = &DioEvt_Queue[DIOEVT_QUEUE_INDEX(Tail)];
+    EventPtr->ChannelId = Event->ChannelId;
+    EventPtr->Edge = Event->Edge;
+    EventPtr->Timestamp = Event->Timestamp;
+
+    // Slot released only after it was copied
+    DioEvt_Tail = (uint8)(Tail + 1U);
+    return E_OK;
+}
+
+/**
+ * @name : DioEvt_GetEventCount
+ * @param: NONE
+ * Reentrant
+ * Sync
+ * @Return: Number of queued events
+ **/
+uint8 DioEvt_GetEventCount(void)
+{
+    return (uint8)(DioEvt_Head - DioEvt_Tail);
+}
+
+/**
+ * @name : DioEvt_GetLostEventCount
+ * @param: NONE
+ * Reentrant
+ * Sync
+ * @Return: Number of events dropped because the queue was full
+ **/
+uint16 DioEvt_GetLostEventCount(void)
+{
+    return DioEvt_LostEvents;
+}
+
+/**
+ * @name : DioEvt_ScanPort
+ * @param: PortId: DIO_PORTTYPE_PORTx
+ * Non Reentrant, same context as DioEvt_MainFunction
+ * Sync
+ * @Description: Queues the subscribed edges of one port, meant for the
+ *               EXTI handler of its pins.
+ **/
+void DioEvt_ScanPort(Dio_PortType PortId)
+{
+#ifdef DioEvtDevErrorDetect
+    if (DioEvt_Initialized == FALSE)
+    {
+        Det_ReportError(DIOEVT_ModuleId, 0, DioEvt_ApiID_DioEvt_ScanPort, DIOEVT_E_UNINIT);
+        return;
+    }
+    if (PortId >= DIOEVT_PORT_NUM)
+    {
+        Det_ReportError(DIOEVT_ModuleId, 0, DioEvt_ApiID_DioEvt_ScanPort, DIOEVT_E_PARAM_PORT);
+        return;
+    }
+#endif
+    DioEvt_StaticScan(PortId);
+    return;
+}
+
+/**
+ * @name : DioEvt_MainFunction
+ * @param: NONE
+ * @Description: Queues the subscribed edges of every port.
+ *               To be called at a fixed period.
+ **/
+void DioEvt_MainFunction(void)
+{
+    uint8 PortNum = 0;
+
+    if (DioEvt_Initialized == FALSE)
+    {
+        return;
+    }
+    DioEvt_Tick++;
+    for (PortNum = 0; PortNum < DIOEVT_PORT_NUM; PortNum++)
+    {
+        if ((DioEvt_PortConfig[PortNum].RisingMask | DioEvt_PortConfig[PortNum].FallingMask) != 0)
+        {
+            DioEvt_StaticScan(PortNum);
+        }
+    }
+    return;
+}
+
+/************************************************************************/
+/*                    Local functions Definitions                       */
+/************************************************************************/
+
+/**
+ * @name : DioEvt_StaticScan
+ * @param: PortNum: port index
+ * @Description: One IDR read, the changed pins from the XOR with the last
+ *               snapshot, then one queue entry per subscribed edge.
+ **/
+LOCAL_INLINE void DioEvt_StaticScan(uint8 PortNum)
+{
+    const DioEvt_PortConfigType *Config = &DioEvt_PortConfig[PortNum];
+    uint16 Sample = (uint16)(DIOEVT_PORT_IDR(PortNum) & (Config->RisingMask | Config->FallingMask));
+    uint16 Changed = Sample ^ DioEvt_Snapshot[PortNum];
+    uint16 Rising = Changed & Sample & Config->RisingMask;
+    uint16 Events = Rising | (Changed & (uint16)~Sample & Config->FallingMask);
+    uint16 Timestamp = 0;
+    uint8 Head = DioEvt_Head;
+    uint8 Pin = 0;
+    volatile DioEvt_EventType *Event = NULL_PTR;
+
+    DioEvt_Snapshot[PortNum] = Sample;
+    if (Events == 0)
+    {
+        return;
+    }
+    Timestamp = DioEvtGetTimestamp();
+    while (Events != 0)
+    {
+        Pin = (uint8)CTZ(Events);
+        Events &= (uint16)(Events - 1U);
+        if ((uint8)(Head - DioEvt_Tail) >= DioEvtQueueSize)
+        {
+            DioEvt_LostEvents++;
+            continue;
+        }
+        Event = &DioEvt_Queue[DIOEVT_QUEUE_INDEX(Head)];
+        Event->ChannelId = (Dio_ChannelType)((PortNum << 4) + Pin);
+        Event->Edge = ((Rising >> Pin) & 0x01U) ? DIOEVT_EDGE_RISING : DIOEVT_EDGE_FALLING;
+        Event->Timestamp = Timestamp;
+        Head++;
+    }
+
+    // Events published together once written
+    DioEvt_Head = Head;
+    return;
+}
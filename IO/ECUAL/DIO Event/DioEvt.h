@@ -0,0 +1,70 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : DioEvt.h                                                 */
+/* Note      : Input change detection of whole ports: the IDR of every  */
+/*             subscribed port is compared with its previous snapshot   */
+/*             and each subscribed edge is queued as an event.          */
+/*             The queue is single producer (DioEvt_MainFunction or     */
+/*             DioEvt_ScanPort, from one context) / single consumer     */
+/*             (DioEvt_ReadEvent) and needs no lock.                    */
+/************************************************************************/
+
+#ifndef DIOEVT_H
+#define DIOEVT_H
+
+#include "STD_TYPES.h"
+#include "DIO.h"
+#include "DioEvt_Cfg.h"
+
+/************************************************************************/
+/*                          Published Info                              */
+/************************************************************************/
+
+#define DIOEVT_ModuleId                 (208U)
+#define DIOEVT_VendorId                 (483U)
+
+#define DIOEVT_SW_MAJOR_VERSION         (1U)
+#define DIOEVT_SW_MINOR_VERSION         (0U)
+#define DIOEVT_SW_PATCH_VERSION         (0U)
+
+/************************************************************************/
+/*                                DET                                   */
+/************************************************************************/
+#define DIOEVT_E_PARAM_POINTER          0x01
+#define DIOEVT_E_PARAM_PORT             0x02
+#define DIOEVT_E_UNINIT                 0x05
+
+/************************************************************************/
+/*                          Published types                             */
+/************************************************************************/
+
+typedef uint8 DioEvt_EdgeType;
+#define DIOEVT_EDGE_FALLING             ((DioEvt_EdgeType)0U)
+#define DIOEVT_EDGE_RISING              ((DioEvt_EdgeType)1U)
+
+typedef struct
+{
+    Dio_ChannelType ChannelId;
+    DioEvt_EdgeType Edge;
+    uint16 Timestamp;
+} DioEvt_EventType;
+
+/************************************************************************/
+/*                      Functions Declaration                           */
+/************************************************************************/
+
+void DioEvt_Init( void );
+
+Std_ReturnType DioEvt_ReadEvent( DioEvt_EventType *EventPtr );
+
+uint8 DioEvt_GetEventCount( void );
+
+uint16 DioEvt_GetLostEventCount( void );
+
+void DioEvt_ScanPort( Dio_PortType PortId );
+
+void DioEvt_MainFunction( void );
+
+#endif // EOF
@@ -0,0 +1,28 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : DioEvt_Cfg.h                                             */
+/************************************************************************/
+
+#ifndef DIOEVT_CFG_H
+#define DIOEVT_CFG_H
+
+#include "DIO_cfg.h"
+
+// DioEvt General Container
+
+// Switches the development error detection and notification on or off.
+#define DioEvtDevErrorDetect
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Event queue length, power of 2 (<= 128)
+#define DioEvtQueueSize                 32U
+
+/*  Timestamp of the events, any free running 16 bit counter.
+    Default: the number of DioEvt_MainFunction calls.
+*/
+#define DioEvtGetTimestamp()            (DioEvt_Tick)
+
+#endif
@@ -0,0 +1,247 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : Deb.c                                                    */
+/************************************************************************/
+
+// Each pin has a 4 bit counter of the consecutive samples that differ
+// from its stable level. The counters of the 16 pins of a port are
+// stored bit-sliced: Deb_Count[port][i] holds bit i of every counter,
+// so incrementing, clearing and comparing all of them is a few word
+// operations per bit plane. A pin toggles its stable level when its
+// counter reaches the port depth.
+
+#include "det.h"
+#include "hw_reg.h"
+#include "DIO.h"
+#include "Deb.h"
+
+/************************************************************************/
+/*                          Global Constants                            */
+/************************************************************************/
+#define Deb_ApiID_Deb_GetPortState 0x01
+#define Deb_ApiID_Deb_GetChannelState 0x02
+#define Deb_ApiID_Deb_GetPortEdges 0x03
+
+#define DEB_PORT_NUM 3U
+
+// Counter bit planes: depth 1 ~ 15
+#define DEB_PLANES 4U
+
+#if (DebPortADepth == 0U) || (DebPortADepth > 15U) || (DebPortBDepth == 0U) || (DebPortBDepth > 15U) || \
+    (DebPortCDepth == 0U) || (DebPortCDepth > 15U)
+#error "Deb: port depth must be 1 ~ 15"
+#endif
+
+#define DEB_PORT_IDR(PortNum) \
+    (*((volatile uint32 *)(GPIOA_BASE + ((uint32)(PortNum) * GPIO_PORT_STRIDE) + GPIO_IDR_OFFSET)))
+
+/************************************************************************/
+/*                          Local types                                 */
+/************************************************************************/
+typedef struct
+{
+    uint16 Mask;
+    uint8 Depth;
+} Deb_PortConfigType;
+
+/************************************************************************/
+/*                          Local functions                             */
+/************************************************************************/
+static void Deb_StaticTick(uint8 PortNum, uint16 Sample);
+
+/************************************************************************/
+/*                         Global variables                             */
+/************************************************************************/
+static const Deb_PortConfigType Deb_PortConfig[DEB_PORT_NUM] =
+{
+    {DebPortAMask, DebPortADepth},
+    {DebPortBMask, DebPortBDepth},
+    {DebPortCMask, DebPortCDepth}
+};
+
+static boolean Deb_Initialized = FALSE;
+
+// Debounced level of every pin
+static uint16 Deb_State[DEB_PORT_NUM];
+
+// Bit-sliced counters
+static uint16 Deb_Count[DEB_PORT_NUM][DEB_PLANES];
+
+// Edges accepted since the last Deb_GetPortEdges
+static uint16 Deb_Rising[DEB_PORT_NUM];
+static uint16 Deb_Falling[DEB_PORT_NUM];
+
+/************************************************************************/
+/*                         APIS definitions                             */
+/************************************************************************/
+/**
+ * @name : Deb_Init
+ * @param: NONE
+ * Non Reentrant
+ * Sync
+ * Takes the current input levels as the stable state, no edges reported.
+ **/
+void Deb_Init(void)
+{
+    uint8 PortNum = 0;
+    uint8 Plane = 0;
+
+    for (PortNum = 0; PortNum < DEB_PORT_NUM; PortNum++)
+    {
+        Deb_State[PortNum] = (Deb_PortConfig[PortNum].Mask != 0)
+                                 ? (uint16)(DEB_PORT_IDR(PortNum) & Deb_PortConfig[PortNum].Mask)
+                                 : 0U;
+        for (Plane = 0; Plane < DEB_PLANES; Plane++)
+        {
+            Deb_Count[PortNum][Plane] = 0;
+        }
+        Deb_Rising[PortNum] = 0;
+        Deb_Falling[PortNum] = 0;
+    }
+    Deb_Initialized = TRUE;
+    return;
+}
+
+/**
+ * @name : Deb_GetPortState
+ * @param: PortId: DIO_PORTTYPE_PORTx
+ * Reentrant
+ * Sync
+ * @Return: Debounced level of the port pins (0 outside the port mask)
+ **/
+Dio_PortLevelType Deb_GetPortState(Dio_PortType PortId)
+{
+#ifdef DebDevErrorDetect
+    if (PortId >= DEB_PORT_NUM)
+    {
+        Det_ReportError(DEB_ModuleId, 0, Deb_ApiID_Deb_GetPortState, DEB_E_PARAM_PORT);
+        return 0;
+    }
+#endif
+    return Deb_State[PortId];
+}
+
+/**
+ * @name : Deb_GetChannelState
+ * @param: ChannelId: debounced DIO channel
+ * Reentrant
+ * Sync
+ * @Return: Debounced level STD_HIGH / STD_LOW
+ **/
+Dio_LevelType Deb_GetChannelState(Dio_ChannelType ChannelId)
+{
+#ifdef DebDevErrorDetect
+    if (ChannelId >= DIO_PHYSICAL_CHANNELS ||
+        (Deb_PortConfig[ChannelId >> 4].Mask & (1U << (ChannelId & 0x0FU))) == 0)
+    {
+        Det_ReportError(DEB_ModuleId, 0, Deb_ApiID_Deb_GetChannelState, DEB_E_PARAM_CHANNEL);
+        return STD_LOW;
+    }
+#endif
+    return ((Deb_State[ChannelId >> 4] >> (ChannelId & 0x0FU)) & 0x01U) ? STD_HIGH : STD_LOW;
+}
+
+/**
+ * @name : Deb_GetPortEdges
+ * @param: PortId: DIO_PORTTYPE_PORTx
+ *         RisingPtr: pins that became high since the last call
+ *         FallingPtr: pins that became low since the last call
+ * Non Reentrant, same task as Deb_MainFunction
+ * Sync
+ * The returned edges are cleared.
+ **/
+void Deb_GetPortEdges(Dio_PortType PortId, Dio_PortLevelType *RisingPtr, Dio_PortLevelType *FallingPtr)
+{
+#ifdef DebDevErrorDetect
+    if (Deb_Initialized == FALSE)
+    {
+        Det_ReportError(DEB_ModuleId, 0, Deb_ApiID_Deb_GetPortEdges, DEB_E_UNINIT);
+        return;
+    }
+    if (PortId >= DEB_PORT_NUM)
+    {
+        Det_ReportError(DEB_ModuleId, 0, Deb_ApiID_Deb_GetPortEdges, DEB_E_PARAM_PORT);
+        return;
+    }
+    if (RisingPtr == NULL_PTR || FallingPtr == NULL_PTR)
+    {
+        Det_ReportError(DEB_ModuleId, 0, Deb_ApiID_Deb_GetPortEdges, DEB_E_PARAM_POINTER);
+        return;
+    }
+#endif
+    *RisingPtr = Deb_Rising[PortId];
+    *FallingPtr = Deb_Falling[PortId];
+    Deb_Rising[PortId] = 0;
+    Deb_Falling[PortId] = 0;
+    return;
+}
+
+/**
+ * @name : Deb_MainFunction
+ * @param: NONE
+ * @Description: Samples every configured port once and advances its counters.
+ *               To be called at a fixed period.
+ **/
+void Deb_MainFunction(void)
+{
+    uint8 PortNum = 0;
+
+    if (Deb_Initialized == FALSE)
+    {
+        return;
+    }
+    for (PortNum = 0; PortNum < DEB_PORT_NUM; PortNum++)
+    {
+        if (Deb_PortConfig[PortNum].Mask != 0)
+        {
+            Deb_StaticTick(PortNum, (uint16)(DEB_PORT_IDR(PortNum) & Deb_PortConfig[PortNum].Mask));
+        }
+    }
+    return;
+}
+
+/************************************************************************/
+/*                    Local functions Definitions                       */
+/************************************************************************/
+
+/**
+ * @name : Deb_StaticTick
+ * @param: PortNum: port index
+ *         Sample: masked IDR
+ * @Description: one debounce step of the 16 pins of a port
+ **/
+static void Deb_StaticTick(uint8 PortNum, uint16 Sample)
+{
+    uint16 *Count = Deb_Count[PortNum];
+    uint8 Depth = Deb_PortConfig[PortNum].Depth;
+    uint16 Delta = Sample ^ Deb_State[PortNum];
+    uint16 Carry = Delta;
+    uint16 Reached = Delta;
+    uint16 Next = 0;
+    uint8 Plane = 0;
+
+    for (Plane = 0; Plane < DEB_PLANES; Plane++)
+    {
+        // +1 where the pin differs from its stable level, 0 where it doesn't
+        Next = Count[Plane] & Carry;
+        Count[Plane] = (Count[Plane] ^ Carry) & Delta;
+        Carry = Next;
+
+        // counter == Depth, bit plane by bit plane
+        Reached &= ((Depth >> Plane) & 0x01U) ? Count[Plane] : (uint16)~Count[Plane];
+    }
+
+    if (Reached != 0)
+    {
+        Deb_State[PortNum] ^= Reached;
+        Deb_Rising[PortNum] |= Reached & Sample;
+        Deb_Falling[PortNum] |= Reached & (uint16)~Sample;
+        for (Plane = 0; Plane < DEB_PLANES; Plane++)
+        {
+            Count[Plane] &= (uint16)~Reached;
+        }
+    }
+    return;
+}
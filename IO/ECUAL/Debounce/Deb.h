@@ -0,0 +1,52 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : Deb.h                                                    */
+/* Note      : Input debouncing of whole ports with bit-sliced          */
+/*             (vertical) counters: one IDR read and a fixed number of  */
+/*             logic operations per port and tick, whatever the number  */
+/*             of debounced pins.                                       */
+/************************************************************************/
+
+#ifndef DEB_H
+#define DEB_H
+
+#include "STD_TYPES.h"
+#include "DIO.h"
+#include "Deb_Cfg.h"
+
+/************************************************************************/
+/*                          Published Info                              */
+/************************************************************************/
+
+#define DEB_ModuleId                    (207U)
+#define DEB_VendorId                    (483U)
+
+#define DEB_SW_MAJOR_VERSION            (1U)
+#define DEB_SW_MINOR_VERSION            (0U)
+#define DEB_SW_PATCH_VERSION            (0U)
+
+/************************************************************************/
+/*                                DET                                   */
+/************************************************************************/
+#define DEB_E_PARAM_POINTER             0x01
+#define DEB_E_PARAM_PORT                0x02
+#define DEB_E_PARAM_CHANNEL             0x03
+#define DEB_E_UNINIT                    0x05
+
+/************************************************************************/
+/*                      Functions Declaration                           */
+/************************************************************************/
+
+void Deb_Init( void );
+
+Dio_PortLevelType Deb_GetPortState( Dio_PortType PortId );
+
+Dio_LevelType Deb_GetChannelState( Dio_ChannelType ChannelId );
+
+void Deb_GetPortEdges( Dio_PortType PortId, Dio_PortLevelType *RisingPtr, Dio_PortLevelType *FallingPtr );
+
+void Deb_MainFunction( void );
+
+#endif // EOF
@@ -0,0 +1,34 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : Deb_Cfg.h                                                */
+/************************************************************************/
+
+#ifndef DEB_CFG_H
+#define DEB_CFG_H
+
+#include "DIO_cfg.h"
+
+// Deb General Container
+
+// Switches the development error detection and notification on or off.
+#define DebDevErrorDetect
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*  Per port: debounced pins (mask, 0 = port not sampled) and depth, the number
+    of consecutive Deb_MainFunction samples an input must keep its new level
+    before the change is accepted (1 ~ 15).
+    Debounce time = depth x Deb_MainFunction period.
+*/
+#define DebPortAMask                    0x0000U
+#define DebPortADepth                   4U
+
+#define DebPortBMask                    0x0008U     // B3
+#define DebPortBDepth                   4U
+
+#define DebPortCMask                    0x0000U
+#define DebPortCDepth                   8U
+
+#endif
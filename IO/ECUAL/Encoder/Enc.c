@@ -0,0 +1,259 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : Enc.c                                                    */
+/************************************************************************/
+
+#include "det.h"
+#include "hw_reg.h"
+#include "DIO.h"
+#include "Enc.h"
+
+/************************************************************************/
+/*                          Global Constants                            */
+/************************************************************************/
+#define Enc_ApiID_Enc_Init 0x00
+#define Enc_ApiID_Enc_GetPosition 0x01
+#define Enc_ApiID_Enc_SetPosition 0x02
+#define Enc_ApiID_Enc_GetErrorCount 0x03
+
+#define ENC_PORT_NUM 3U
+
+/*  Transition index = (previous B A << 2) | (B A)
+    Forward: 00 -> 01 -> 11 -> 10 -> 00
+*/
+#define ENC_INDEX(Previous, State) ((uint8)(((Previous) << 2) | (State)))
+
+// Transitions with both A and B changed (0 -> 3, 1 -> 2, 2 -> 1, 3 -> 0): a sample was missed
+#define ENC_ERROR_TRANSITIONS (0x1248U)
+
+#define ENC_PORT_IDR(PortNum) \
+    (*((volatile uint32 *)(GPIOA_BASE + ((uint32)(PortNum) * GPIO_PORT_STRIDE) + GPIO_IDR_OFFSET)))
+
+/************************************************************************/
+/*                          Local types                                 */
+/************************************************************************/
+typedef struct
+{
+    sint32 Position;
+    uint32 Errors;
+    uint8 Previous;
+    uint8 PortNum;
+    uint8 ShiftA;
+    uint8 ShiftB;
+} Enc_StateType;
+
+/************************************************************************/
+/*                          Local functions                             */
+/************************************************************************/
+LOCAL_INLINE uint8 Enc_StaticReadState(const Enc_StateType *Encoder, const uint32 *Idr);
+
+/************************************************************************/
+/*                         Global variables                             */
+/************************************************************************/
+static const Enc_ConfigType Enc_Config[EncNumber] = EncChannelList;
+
+// Position step of every transition
+static const sint8 Enc_Step[16] =
+{
+     0, +1, -1,  0,
+    -1,  0,  0, +1,
+    +1,  0,  0, -1,
+     0, -1, +1,  0
+};
+
+static boolean Enc_Initialized = FALSE;
+
+static Enc_StateType Enc_State[EncNumber];
+
+// Bit x: port x has an encoder
+static uint8 Enc_UsedPorts = 0;
+
+/************************************************************************/
+/*                         APIS definitions                             */
+/************************************************************************/
+/**
+ * @name : Enc_Init
+ * @param: NONE
+ * Non Reentrant
+ * Sync
+ * Positions and error counters to 0, the current levels as start state.
+ **/
+void Enc_Init(void)
+{
+    uint32 Idr[ENC_PORT_NUM] = {0};
+    uint8 EncoderId = 0;
+    uint8 PortNum = 0;
+
+    Enc_UsedPorts = 0;
+    for (EncoderId = 0; EncoderId < EncNumber; EncoderId++)
+    {
+#ifdef EncDevErrorDetect
+        if (Enc_Config[EncoderId].ChannelA >= DIO_PHYSICAL_CHANNELS ||
+            Enc_Config[EncoderId].ChannelB >= DIO_PHYSICAL_CHANNELS ||
+            (Enc_Config[EncoderId].ChannelA >> 4) != (Enc_Config[EncoderId].ChannelB >> 4))
+        {
+            Det_ReportError(ENC_ModuleId, 0, Enc_ApiID_Enc_Init, ENC_E_PARAM_CONFIG);
+            return;
+        }
+#endif
+        Enc_State[EncoderId].PortNum = Enc_Config[EncoderId].ChannelA >> 4;
+        Enc_State[EncoderId].ShiftA = Enc_Config[EncoderId].ChannelA & 0x0FU;
+        Enc_State[EncoderId].ShiftB = Enc_Config[EncoderId].ChannelB & 0x0FU;
+        Enc_State[EncoderId].Position = 0;
+        Enc_State[EncoderId].Errors = 0;
+        Enc_UsedPorts |= (uint8)(1U << Enc_State[EncoderId].PortNum);
+    }
+
+    for (PortNum = 0; PortNum < ENC_PORT_NUM; PortNum++)
+    {
+        if (Enc_UsedPorts & (1U << PortNum))
+        {
+            Idr[PortNum] = ENC_PORT_IDR(PortNum);
+        }
+    }
+    for (EncoderId = 0; EncoderId < EncNumber; EncoderId++)
+    {
+        Enc_State[EncoderId].Previous = Enc_StaticReadState(&Enc_State[EncoderId], Idr);
+    }
+    Enc_Initialized = TRUE;
+    return;
+}
+
+/**
+ * @name : Enc_GetPosition
+ * @param: EncoderId: index in EncChannelList
+ * Reentrant
+ * Sync
+ * @Return: Position in edges (4 per encoder cycle), forward = increasing
+ **/
+sint32 Enc_GetPosition(Enc_EncoderType EncoderId)
+{
+#ifdef EncDevErrorDetect
+    if (EncoderId >= EncNumber)
+    {
+        Det_ReportError(ENC_ModuleId, 0, Enc_ApiID_Enc_GetPosition, ENC_E_PARAM_ENCODER);
+        return 0;
+    }
+#endif
+    return Enc_State[EncoderId].Position;
+}
+
+/**
+ * @name : Enc_SetPosition
+ * @param: EncoderId: index in EncChannelList
+ *         Position: new position
+ * Non Reentrant
+ * Sync
+ * Steps sampled while the position is written can be lost, set it while
+ * the shaft is at rest or from the sampling context.
+ **/
+void Enc_SetPosition(Enc_EncoderType EncoderId, sint32 Position)
+{
+#ifdef EncDevErrorDetect
+    if (EncoderId >= EncNumber)
+    {
+        Det_ReportError(ENC_ModuleId, 0, Enc_ApiID_Enc_SetPosition, ENC_E_PARAM_ENCODER);
+        return;
+    }
+#endif
+    Enc_State[EncoderId].Position = Position;
+    return;
+}
+
+/**
+ * @name : Enc_GetErrorCount
+ * @param: EncoderId: index in EncChannelList
+ * Reentrant
+ * Sync
+ * @Return: Number of invalid transitions (A and B changed between two
+ *          samples), the sample rate is too low for the shaft speed.
+ **/
+uint32 Enc_GetErrorCount(Enc_EncoderType EncoderId)
+{
+#ifdef EncDevErrorDetect
+    if (EncoderId >= EncNumber)
+    {
+        Det_ReportError(ENC_ModuleId, 0, Enc_ApiID_Enc_GetErrorCount, ENC_E_PARAM_ENCODER);
+        return 0;
+    }
+#endif
+    return Enc_State[EncoderId].Errors;
+}
+
+/**
+ * @name : Enc_Sample
+ * @param: NONE
+ * Non Reentrant
+ * Sync
+ * @Description: One sample of every encoder, each used port is read once.
+ *               To be called from a timer interrupt at a fixed rate, higher
+ *               than 4 x the fastest encoder cycle rate.
+ **/
+void Enc_Sample(void)
+{
+    uint32 Idr[ENC_PORT_NUM] = {0};
+    Enc_StateType *Encoder = Enc_State;
+    uint8 State = 0;
+    uint8 Index = 0;
+
+    if (Enc_Initialized == FALSE)
+    {
+        return;
+    }
+    if (Enc_UsedPorts & 0x01U)
+    {
+        Idr[0] = ENC_PORT_IDR(0);
+    }
+    if (Enc_UsedPorts & 0x02U)
+    {
+        Idr[1] = ENC_PORT_IDR(1);
+    }
+    if (Enc_UsedPorts & 0x04U)
+    {
+        Idr[2] = ENC_PORT_IDR(2);
+    }
+
+    for (; Encoder < &Enc_State[EncNumber]; Encoder++)
+    {
+        State = Enc_StaticReadState(Encoder, Idr);
+        Index = ENC_INDEX(Encoder->Previous, State);
+        Encoder->Position += Enc_Step[Index];
+        Encoder->Errors += (ENC_ERROR_TRANSITIONS >> Index) & 0x01U;
+        Encoder->Previous = State;
+    }
+    return;
+}
+
+/**
+ * @name : Enc_EdgeNotification
+ * @param: ChannelId: channel with an edge
+ * Non Reentrant
+ * Sync
+ * @Description: Exti_HandlerType wrapper of Enc_Sample, to sample on the
+ *               edges of the encoder channels instead of a timer.
+ **/
+void Enc_EdgeNotification(Dio_ChannelType ChannelId)
+{
+    (void)ChannelId;
+    Enc_Sample();
+    return;
+}
+
+/************************************************************************/
+/*                    Local functions Definitions                       */
+/************************************************************************/
+
+/**
+ * @name : Enc_StaticReadState
+ * @param: Encoder: encoder
+ *         Idr: IDR of the ports
+ * @Return: B A levels (bit 1 = B, bit 0 = A)
+ **/
+LOCAL_INLINE uint8 Enc_StaticReadState(const Enc_StateType *Encoder, const uint32 *Idr)
+{
+    uint32 Port = Idr[Encoder->PortNum];
+
+    return (uint8)(((Port >> Encoder->ShiftA) & 0x01U) | (((Port >> Encoder->ShiftB) & 0x01U) << 1));
+}
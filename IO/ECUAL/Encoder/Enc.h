@@ -0,0 +1,65 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : Enc.h                                                    */
+/* Note      : Quadrature decoding of encoders on DIO channels: one IDR */
+/*             read per used port and sample, then a 16 entry           */
+/*             (previous state, state) lookup per encoder. Positions    */
+/*             count every edge of A and B (4 per encoder cycle).       */
+/************************************************************************/
+
+#ifndef ENC_H
+#define ENC_H
+
+#include "STD_TYPES.h"
+#include "DIO.h"
+#include "Enc_Cfg.h"
+
+/************************************************************************/
+/*                          Published Info                              */
+/************************************************************************/
+
+#define ENC_ModuleId                    (210U)
+#define ENC_VendorId                    (483U)
+
+#define ENC_SW_MAJOR_VERSION            (1U)
+#define ENC_SW_MINOR_VERSION            (0U)
+#define ENC_SW_PATCH_VERSION            (0U)
+
+/************************************************************************/
+/*                                DET                                   */
+/************************************************************************/
+#define ENC_E_PARAM_ENCODER             0x01
+#define ENC_E_PARAM_CONFIG              0x02
+#define ENC_E_UNINIT                    0x05
+
+/************************************************************************/
+/*                          Published types                             */
+/************************************************************************/
+
+typedef uint8 Enc_EncoderType;
+
+typedef struct
+{
+    Dio_ChannelType ChannelA;
+    Dio_ChannelType ChannelB;
+} Enc_ConfigType;
+
+/************************************************************************/
+/*                      Functions Declaration                           */
+/************************************************************************/
+
+void Enc_Init( void );
+
+sint32 Enc_GetPosition( Enc_EncoderType EncoderId );
+
+void Enc_SetPosition( Enc_EncoderType EncoderId, sint32 Position );
+
+uint32 Enc_GetErrorCount( Enc_EncoderType EncoderId );
+
+void Enc_Sample( void );
+
+void Enc_EdgeNotification( Dio_ChannelType ChannelId );
+
+#endif // EOF
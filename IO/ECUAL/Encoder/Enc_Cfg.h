@@ -0,0 +1,33 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : Enc_Cfg.h                                                */
+/************************************************************************/
+
+#ifndef ENC_CFG_H
+#define ENC_CFG_H
+
+#include "DIO_cfg.h"
+
+// Enc General Container
+
+// Switches the development error detection and notification on or off.
+#define EncDevErrorDetect
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*  Encoders: { channel A, channel B }, both channels of an encoder on the same port.
+    The encoder ID is the index in the list.
+    Default pins: A0 ~ A2 and A15, not used by the SPI CS decoder, the display
+    connector (Pbus / Hmi), the Deb / DioEvt inputs or the chip selects.
+*/
+#define EncNumber                       2U
+
+#define EncChannelList                                      \
+{                                                           \
+    {DIO_CHANNEL_A0, DIO_CHANNEL_A1},   /* 0: spindle */    \
+    {DIO_CHANNEL_A2, DIO_CHANNEL_A15}   /* 1: feed */       \
+}
+
+#endif
@@ -0,0 +1,309 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : Hmi.c                                                    */
+/************************************************************************/
+
+// Hmi_MainFunction reads the columns of the row driven since the previous
+// call, so they had a whole period to settle and no delay is needed, then
+// switches to the next row. Rows and segments are written as groups: all
+// their pins change with the same BSRR store, no pin sees an intermediate
+// pattern and the neighbouring rows / digits don't ghost.
+
+#include "det.h"
+#include "compiler.h"
+#include "DIO.h"
+#include "spi_Cfg.h"
+#include "Tft_Cfg.h"
+#include "Sd_Cfg.h"
+#include "IoExp_Cfg.h"
+#include "Deb_Cfg.h"
+#include "Hmi.h"
+
+/************************************************************************/
+/*                          Global Constants                            */
+/************************************************************************/
+#define Hmi_ApiID_Hmi_Init 0x00
+#define Hmi_ApiID_Hmi_GetKeyEvents 0x01
+#define Hmi_ApiID_Hmi_SetDigit 0x02
+#define Hmi_ApiID_Hmi_SetSegments 0x03
+
+#define HMI_KEYS (HmiRows * HmiColumns)
+
+#if (HMI_KEYS > 16U) || (HmiRows == 0U) || (HmiColumns == 0U)
+#error "Hmi: the keypad has 1 ~ 16 keys"
+#endif
+
+// Segments and rows share the display connector with the Pbus data bus and strobes
+#if DioDisplayFrontEnd != DIO_DISPLAY_HMI
+#error "Hmi: the display connector is assigned to Pbus (DioDisplayFrontEnd, DIO_cfg.h)"
+#endif
+
+// Group pins of a port (segments, rows, columns)
+#define HMI_PORT_PINS(PortId)                                                                        \
+    ((((PortId) == DIO_GROUP_SEGMENTS_PORT) ? DIO_GROUP_SEGMENTS_MASK : 0U) |                        \
+     (((PortId) == DIO_GROUP_KEYPAD_ROWS_PORT) ? DIO_GROUP_KEYPAD_ROWS_MASK : 0U) |                  \
+     (((PortId) == DIO_GROUP_KEYPAD_COLS_PORT) ? DIO_GROUP_KEYPAD_COLS_MASK : 0U))
+
+// Pins of a port driven or read by the other modules
+#define HMI_OTHER_PINS(PortId)                                                                       \
+    (DIO_PORT_PIN_BIT((PortId), DIO_CHANNEL_A5) | DIO_PORT_PIN_BIT((PortId), DIO_CHANNEL_A6) |       \
+     DIO_PORT_PIN_BIT((PortId), DIO_CHANNEL_A7) |                /* SPI1 SCK, MISO, MOSI */          \
+     (((PortId) == SpiCsDecoderPort) ? SpiCsDecoderMask : 0UL) |                                     \
+     DIO_PORT_PIN_BIT((PortId), SpiCsDecoderEnableChannel) |                                         \
+     DIO_PORT_PIN_BIT((PortId), TftCsChannel) | DIO_PORT_PIN_BIT((PortId), TftDcChannel) |           \
+     DIO_PORT_PIN_BIT((PortId), SdCsChannel) |                                                       \
+     DIO_PORT_PIN_BIT((PortId), IoExpLatchChannel) | DIO_PORT_PIN_BIT((PortId), IoExpLoadChannel) |  \
+     (((PortId) == DIO_PORTTYPE_PORTA) ? (DebPortAMask | DioEventRisingMaskPortA | DioEventFallingMaskPortA) : \
+      ((PortId) == DIO_PORTTYPE_PORTB) ? (DebPortBMask | DioEventRisingMaskPortB | DioEventFallingMaskPortB) : \
+                                         (DebPortCMask | DioEventRisingMaskPortC | DioEventFallingMaskPortC)))
+
+#if ((HMI_PORT_PINS(DIO_PORTTYPE_PORTA) & HMI_OTHER_PINS(DIO_PORTTYPE_PORTA)) != 0UL) || \
+    ((HMI_PORT_PINS(DIO_PORTTYPE_PORTB) & HMI_OTHER_PINS(DIO_PORTTYPE_PORTB)) != 0UL) || \
+    ((HMI_PORT_PINS(DIO_PORTTYPE_PORTC) & HMI_OTHER_PINS(DIO_PORTTYPE_PORTC)) != 0UL)
+#error "Hmi: a group pin is used by another module (SPI1, CS decoder, Tft, Sd, IoExp, Deb, DioEvt)"
+#endif
+
+#define HMI_ROW_MASK ((1U << HmiRows) - 1U)
+#define HMI_COLUMN_MASK ((1U << HmiColumns) - 1U)
+
+#define HMI_SEGMENT_BITS 8U
+
+#ifdef HmiSegmentActiveLow
+#define HMI_SEGMENT_LEVEL(Segments) ((Dio_PortLevelType)(~(Segments) & 0xFFU))
+#else
+#define HMI_SEGMENT_LEVEL(Segments) ((Dio_PortLevelType)(Segments))
+#endif
+
+/************************************************************************/
+/*                          Local functions                             */
+/************************************************************************/
+static void Hmi_StaticDebounceRow(uint8 Row, uint8 Columns);
+
+/************************************************************************/
+/*                         Global variables                             */
+/************************************************************************/
+// Segments of 0 ~ F and blank
+static const uint8 Hmi_SegmentTable[HMI_DIGIT_BLANK + 1U] =
+{
+    0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07,
+    0x7F, 0x6F, 0x77, 0x7C, 0x39, 0x5E, 0x79, 0x71,
+    0x00
+};
+
+static const Dio_ChannelGroupType *Hmi_Rows = &MyDioGroupArray[HmiRowGroup];
+static const Dio_ChannelGroupType *Hmi_Columns = &MyDioGroupArray[HmiColumnGroup];
+static const Dio_ChannelGroupType *Hmi_Segments = &MyDioGroupArray[HmiSegmentGroup];
+
+static boolean Hmi_Initialized = FALSE;
+
+// Row group level of every scanned row: that row low, the others high
+static Dio_PortLevelType Hmi_RowLevel[HmiRows];
+
+// Segment group level of every digit
+static Dio_PortLevelType Hmi_Display[HmiRows];
+
+// Driven row
+static uint8 Hmi_Row = 0;
+
+// Debounced keys, pressed / released since the last Hmi_GetKeyEvents
+static Hmi_KeySetType Hmi_Keys = 0;
+static Hmi_KeySetType Hmi_Pressed = 0;
+static Hmi_KeySetType Hmi_Released = 0;
+
+// Scans each key differs from Hmi_Keys
+static uint8 Hmi_KeyCount[HMI_KEYS];
+
+/************************************************************************/
+/*                         APIS definitions                             */
+/************************************************************************/
+/**
+ * @name : Hmi_Init
+ * @param: NONE
+ * Non Reentrant
+ * Sync
+ * Blank display, no key pressed, first row driven.
+ **/
+void Hmi_Init(void)
+{
+    uint8 Index = 0;
+
+#ifdef HmiDevErrorDetect
+    if (POPCOUNT(Hmi_Rows->mask) != HmiRows ||
+        POPCOUNT(Hmi_Columns->mask) != HmiColumns ||
+        POPCOUNT(Hmi_Segments->mask) != HMI_SEGMENT_BITS)
+    {
+        Det_ReportError(HMI_ModuleId, 0, Hmi_ApiID_Hmi_Init, HMI_E_PARAM_CONFIG);
+        return;
+    }
+#endif
+    for (Index = 0; Index < HmiRows; Index++)
+    {
+        Hmi_RowLevel[Index] = HMI_ROW_MASK & ~(1UL << Index);
+        Hmi_Display[Index] = HMI_SEGMENT_LEVEL(Hmi_SegmentTable[HMI_DIGIT_BLANK]);
+    }
+    for (Index = 0; Index < HMI_KEYS; Index++)
+    {
+        Hmi_KeyCount[Index] = 0;
+    }
+    Hmi_Keys = 0;
+    Hmi_Pressed = 0;
+    Hmi_Released = 0;
+
+    Hmi_Row = 0;
+    Dio_WriteChannelGroup(Hmi_Rows, Hmi_RowLevel[0]);
+    Dio_WriteChannelGroup(Hmi_Segments, Hmi_Display[0]);
+    Hmi_Initialized = TRUE;
+    return;
+}
+
+/**
+ * @name : Hmi_GetKeys
+ * @param: NONE
+ * Reentrant
+ * Sync
+ * @Return: Debounced pressed keys
+ **/
+Hmi_KeySetType Hmi_GetKeys(void)
+{
+    return Hmi_Keys;
+}
+
+/**
+ * @name : Hmi_GetKeyEvents
+ * @param: PressedPtr: keys pressed since the last call
+ *         ReleasedPtr: keys released since the last call
+ * Non Reentrant, same task as Hmi_MainFunction
+ * Sync
+ * The returned events are cleared.
+ **/
+void Hmi_GetKeyEvents(Hmi_KeySetType *PressedPtr, Hmi_KeySetType *ReleasedPtr)
+{
+#ifdef HmiDevErrorDetect
+    if (PressedPtr == NULL_PTR || ReleasedPtr == NULL_PTR)
+    {
+        Det_ReportError(HMI_ModuleId, 0, Hmi_ApiID_Hmi_GetKeyEvents, HMI_E_PARAM_POINTER);
+        return;
+    }
+#endif
+    *PressedPtr = Hmi_Pressed;
+    *ReleasedPtr = Hmi_Released;
+    Hmi_Pressed = 0;
+    Hmi_Released = 0;
+    return;
+}
+
+/**
+ * @name : Hmi_SetDigit
+ * @param: Position: digit 0 ~ HmiRows - 1
+ *         Value: 0x0 ~ 0xF, HMI_DIGIT_BLANK
+ * Reentrant
+ * Sync
+ * Shown from the next refresh of the digit.
+ **/
+void Hmi_SetDigit(uint8 Position, uint8 Value)
+{
+#ifdef HmiDevErrorDetect
+    if (Position >= HmiRows)
+    {
+        Det_ReportError(HMI_ModuleId, 0, Hmi_ApiID_Hmi_SetDigit, HMI_E_PARAM_POSITION);
+        return;
+    }
+    if (Value > HMI_DIGIT_BLANK)
+    {
+        Det_ReportError(HMI_ModuleId, 0, Hmi_ApiID_Hmi_SetDigit, HMI_E_PARAM_VALUE);
+        return;
+    }
+#endif
+    Hmi_Display[Position] = HMI_SEGMENT_LEVEL(Hmi_SegmentTable[Value]);
+    return;
+}
+
+/**
+ * @name : Hmi_SetSegments
+ * @param: Position: digit 0 ~ HmiRows - 1
+ *         Segments: HMI_SEGMENT_x bits
+ * Reentrant
+ * Sync
+ **/
+void Hmi_SetSegments(uint8 Position, uint8 Segments)
+{
+#ifdef HmiDevErrorDetect
+    if (Position >= HmiRows)
+    {
+        Det_ReportError(HMI_ModuleId, 0, Hmi_ApiID_Hmi_SetSegments, HMI_E_PARAM_POSITION);
+        return;
+    }
+#endif
+    Hmi_Display[Position] = HMI_SEGMENT_LEVEL(Segments);
+    return;
+}
+
+/**
+ * @name : Hmi_MainFunction
+ * @param: NONE
+ * @Description: One scan step: one column group read, one row group write
+ *               and one segment group write. A full keypad scan and display
+ *               refresh takes HmiRows calls; call it every 1 ~ 4 ms.
+ **/
+void Hmi_MainFunction(void)
+{
+    uint8 Columns = 0;
+
+    if (Hmi_Initialized == FALSE)
+    {
+        return;
+    }
+
+    // pressed keys pull their column low
+    Columns = (uint8)(~Dio_ReadChannelGroup(Hmi_Columns) & HMI_COLUMN_MASK);
+    Hmi_StaticDebounceRow(Hmi_Row, Columns);
+
+    Hmi_Row = (Hmi_Row + 1U < HmiRows) ? (uint8)(Hmi_Row + 1U) : 0U;
+    Dio_WriteChannelGroup(Hmi_Rows, Hmi_RowLevel[Hmi_Row]);
+    Dio_WriteChannelGroup(Hmi_Segments, Hmi_Display[Hmi_Row]);
+    return;
+}
+
+/************************************************************************/
+/*                    Local functions Definitions                       */
+/************************************************************************/
+
+/**
+ * @name : Hmi_StaticDebounceRow
+ * @param: Row: scanned row
+ *         Columns: pressed keys of the row, bit = column
+ * @Description: A key changes once it differed from its debounced level
+ *               in HmiDebounceScans scans of its row in a row.
+ **/
+static void Hmi_StaticDebounceRow(uint8 Row, uint8 Columns)
+{
+    uint8 Key = (uint8)(Row * HmiColumns);
+    uint8 Changed = (uint8)((Columns ^ (Hmi_Keys >> Key)) & HMI_COLUMN_MASK);
+    uint8 Column = 0;
+    Hmi_KeySetType KeyBit = 0;
+
+    for (Column = 0; Column < HmiColumns; Column++, Key++)
+    {
+        if (((Changed >> Column) & 0x01U) == 0)
+        {
+            Hmi_KeyCount[Key] = 0;
+        }
+        else if (++Hmi_KeyCount[Key] >= HmiDebounceScans)
+        {
+            Hmi_KeyCount[Key] = 0;
+            KeyBit = (Hmi_KeySetType)(1U << Key);
+            Hmi_Keys ^= KeyBit;
+            if (Hmi_Keys & KeyBit)
+            {
+                Hmi_Pressed |= KeyBit;
+            }
+            else
+            {
+                Hmi_Released |= KeyBit;
+            }
+        }
+    }
+    return;
+}
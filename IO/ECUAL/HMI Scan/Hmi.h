@@ -0,0 +1,74 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : Hmi.h                                                    */
+/* Note      : Matrix keypad and multiplexed 7 segment display scanned  */
+/*             together on DIO channel groups: each step reads the      */
+/*             columns of the current row and drives the next row and   */
+/*             its digit segments, every row change is one BSRR write.  */
+/************************************************************************/
+
+#ifndef HMI_H
+#define HMI_H
+
+#include "STD_TYPES.h"
+#include "DIO.h"
+#include "Hmi_Cfg.h"
+
+/************************************************************************/
+/*                          Published Info                              */
+/************************************************************************/
+
+#define HMI_ModuleId                    (211U)
+#define HMI_VendorId                    (483U)
+
+#define HMI_SW_MAJOR_VERSION            (1U)
+#define HMI_SW_MINOR_VERSION            (0U)
+#define HMI_SW_PATCH_VERSION            (0U)
+
+/************************************************************************/
+/*                                DET                                   */
+/************************************************************************/
+#define HMI_E_PARAM_POINTER             0x01
+#define HMI_E_PARAM_POSITION            0x02
+#define HMI_E_PARAM_VALUE               0x03
+#define HMI_E_PARAM_CONFIG              0x04
+
+/************************************************************************/
+/*                          Published types                             */
+/************************************************************************/
+
+// Bit (row x HmiColumns + column) = key
+typedef uint16 Hmi_KeySetType;
+
+// Hmi_SetDigit values: 0x0 ~ 0xF, HMI_DIGIT_BLANK
+#define HMI_DIGIT_BLANK                 (0x10U)
+
+// Hmi_SetSegments bits
+#define HMI_SEGMENT_A                   (0x01U)
+#define HMI_SEGMENT_B                   (0x02U)
+#define HMI_SEGMENT_C                   (0x04U)
+#define HMI_SEGMENT_D                   (0x08U)
+#define HMI_SEGMENT_E                   (0x10U)
+#define HMI_SEGMENT_F                   (0x20U)
+#define HMI_SEGMENT_G                   (0x40U)
+#define HMI_SEGMENT_DP                  (0x80U)
+
+/************************************************************************/
+/*                      Functions Declaration                           */
+/************************************************************************/
+
+void Hmi_Init( void );
+
+Hmi_KeySetType Hmi_GetKeys( void );
+
+void Hmi_GetKeyEvents( Hmi_KeySetType *PressedPtr, Hmi_KeySetType *ReleasedPtr );
+
+void Hmi_SetDigit( uint8 Position, uint8 Value );
+
+void Hmi_SetSegments( uint8 Position, uint8 Segments );
+
+void Hmi_MainFunction( void );
+
+#endif // EOF
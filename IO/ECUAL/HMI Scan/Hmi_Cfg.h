@@ -0,0 +1,44 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : Hmi_Cfg.h                                                */
+/************************************************************************/
+
+#ifndef HMI_CFG_H
+#define HMI_CFG_H
+
+#include "DIO_cfg.h"
+
+// Hmi General Container
+
+// Switches the development error detection and notification on or off.
+#define HmiDevErrorDetect
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*  MyDioGroupArray groups (DIO_lcgf.c)
+    Rows: outputs, the scanned row is driven low, it is also the common of
+          the digit with the same index. Default A9 ~ A12.
+    Columns: inputs with pull-up, a pressed key pulls its column low.
+          Default C13 ~ C15.
+    Segments: outputs, bit 0 = a ~ bit 6 = g, bit 7 = dp. Default B8 ~ B15.
+    Segments and rows use the display connector shared with Pbus: Hmi needs
+    DioDisplayFrontEnd = DIO_DISPLAY_HMI (DIO_cfg.h). Hmi.c stops with #error 
+    if a group pin is used by another module.
+*/
+#define HmiRowGroup                     DIO_GROUP_KEYPAD_ROWS
+#define HmiColumnGroup                  DIO_GROUP_KEYPAD_COLS
+#define HmiSegmentGroup                 DIO_GROUP_SEGMENTS
+
+// Keypad size (group widths), rows x columns <= 16. Digits = rows.
+#define HmiRows                         4U
+#define HmiColumns                      3U
+
+// Segments lit by a low level (common anode), comment out for active high
+// #define HmiSegmentActiveLow
+
+// Number of full scans a key has to keep its new level
+#define HmiDebounceScans                3U
+
+#endif
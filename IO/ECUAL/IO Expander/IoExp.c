@@ -0,0 +1,242 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : IoExp.c                                                  */
+/************************************************************************/
+
+// Channel writes only update a shadow image and mark it dirty. One SPI
+// frame per refresh shifts the whole output image into the 595 chain and
+// the 165 chain into the input snapshot at the same time, so reads never
+// touch the bus.
+
+#include "det.h"
+#include "spi.h"
+#include "DIO.h"
+#include "IoExp.h"
+
+/************************************************************************/
+/*                          Global Constants                            */
+/************************************************************************/
+#define IoExp_ApiID_IoExp_WriteChannel 0x01
+#define IoExp_ApiID_IoExp_ReadChannel 0x02
+#define IoExp_ApiID_IoExp_Refresh 0x03
+
+// Both chains are clocked by the same frame
+#define IOEXP_FRAME_BYTES ((IoExpOutputBytes > IoExpInputBytes) ? IoExpOutputBytes : IoExpInputBytes)
+
+/************************************************************************/
+/*                         Global variables                             */
+/************************************************************************/
+static boolean IoExp_Initialized = FALSE;
+
+// Shadow of the outputs, +1 keeps the array valid for an empty chain
+static uint8 IoExp_OutputImage[IoExpOutputBytes + 1U];
+
+// Inputs sampled by the last refresh
+static uint8 IoExp_InputImage[IoExpInputBytes + 1U];
+
+// Output image changed since the last refresh
+static volatile boolean IoExp_Dirty = FALSE;
+
+// SPI frame buffers
+static uint8 IoExp_TxFrame[IOEXP_FRAME_BYTES];
+static uint8 IoExp_RxFrame[IOEXP_FRAME_BYTES];
+
+/************************************************************************/
+/*                         APIS definitions                             */
+/************************************************************************/
+/**
+ * @name : IoExp_Init
+ * @param: NONE
+ * Non Reentrant
+ * Sync
+ * Clears the images, the outputs are driven low by the first refresh.
+ **/
+void IoExp_Init(void)
+{
+    uint8 idx = 0;
+
+    for (idx = 0; idx < IoExpOutputBytes; idx++)
+    {
+        IoExp_OutputImage[idx] = 0;
+    }
+    for (idx = 0; idx < IoExpInputBytes; idx++)
+    {
+        IoExp_InputImage[idx] = 0;
+    }
+    // Latch idle low, 165 in shift mode
+    Dio_WriteChannelFast(IoExpLatchChannel, STD_LOW);
+    Dio_WriteChannelFast(IoExpLoadChannel, STD_HIGH);
+
+    IoExp_Dirty = TRUE;
+    IoExp_Initialized = TRUE;
+    return;
+}
+
+/**
+ * @name : IoExp_WriteChannel
+ * @param: ChannelId: IOEXP_OUT_CHANNEL(n)
+ *         Level: STD_HIGH / STD_LOW
+ * Reentrant for channels of different bytes
+ * Sync
+ * @Description: Updates the shadow image, the pin changes on the next refresh.
+ **/
+void IoExp_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
+{
+    uint8 bit = 0;
+
+#ifdef IoExpDevErrorDetect
+    if (ChannelId < IOEXP_OUT_CHANNEL(0) || ChannelId >= IOEXP_IN_CHANNEL(0))
+    {
+        Det_ReportError(IOEXP_ModuleId, 0, IoExp_ApiID_IoExp_WriteChannel, IOEXP_E_PARAM_CHANNEL);
+        return;
+    }
+#endif
+    bit = (uint8)(ChannelId - IOEXP_OUT_CHANNEL(0));
+    if (Level == STD_HIGH)
+    {
+        SET_BIT(IoExp_OutputImage[bit >> 3], bit & 0x07U);
+    }
+    else
+    {
+        CLR_BIT(IoExp_OutputImage[bit >> 3], bit & 0x07U);
+    }
+    IoExp_Dirty = TRUE;
+    return;
+}
+
+/**
+ * @name : IoExp_ReadChannel
+ * @param: ChannelId: IOEXP_IN_CHANNEL(n), or IOEXP_OUT_CHANNEL(n) to read back the image
+ * Reentrant
+ * Sync
+ * @Return: STD_HIGH / STD_LOW as of the last refresh
+ **/
+Dio_LevelType IoExp_ReadChannel(Dio_ChannelType ChannelId)
+{
+    Dio_LevelType Level = STD_LOW;
+    uint8 bit = 0;
+
+#ifdef IoExpDevErrorDetect
+    if (ChannelId < IOEXP_OUT_CHANNEL(0) || ChannelId >= IOEXP_CHANNEL_END)
+    {
+        Det_ReportError(IOEXP_ModuleId, 0, IoExp_ApiID_IoExp_ReadChannel, IOEXP_E_PARAM_CHANNEL);
+        return STD_LOW;
+    }
+#endif
+    if (ChannelId < IOEXP_IN_CHANNEL(0))
+    {
+        bit = (uint8)(ChannelId - IOEXP_OUT_CHANNEL(0));
+        Level = GET_BIT(IoExp_OutputImage[bit >> 3], bit & 0x07U);
+    }
+    else
+    {
+        bit = (uint8)(ChannelId - IOEXP_IN_CHANNEL(0));
+        Level = GET_BIT(IoExp_InputImage[bit >> 3], bit & 0x07U);
+    }
+    return Level;
+}
+
+/**
+ * @name : IoExp_Flush
+ * @param: NONE
+ * Non Reentrant
+ * Sync
+ * @Return: E_OK: image up to date on the pins
+ *          E_NOT_OK: bus busy, retried by the next refresh
+ * @Description: Refreshes now if outputs changed since the last refresh.
+ **/
+Std_ReturnType IoExp_Flush(void)
+{
+    Std_ReturnType ret = E_OK;
+
+    if (IoExp_Dirty == TRUE)
+    {
+        ret = IoExp_Refresh();
+    }
+    return ret;
+}
+
+/**
+ * @name : IoExp_Refresh
+ * @param: NONE
+ * Non Reentrant
+ * Sync
+ * @Return: E_OK: outputs latched and inputs sampled
+ *          E_NOT_OK: module not initialized or bus busy
+ * @Description: Loads the 165 inputs, shifts one frame through both chains and 
+ *               latches the 595 outputs.
+ **/
+Std_ReturnType IoExp_Refresh(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 idx = 0;
+
+    if (IoExp_Initialized == FALSE)
+    {
+#ifdef IoExpDevErrorDetect
+        Det_ReportError(IOEXP_ModuleId, 0, IoExp_ApiID_IoExp_Refresh, IOEXP_E_UNINIT);
+#endif
+        return E_NOT_OK;
+    }
+    if (Spi_GetStatus() != SPI_IDLE)
+    {
+        return E_NOT_OK;
+    }
+
+    // Writes after this point are kept for the next refresh
+    IoExp_Dirty = FALSE;
+
+    // Farthest 595 first: padding for a longer 165 chain, then the image from the last byte
+    for (idx = 0; idx < IOEXP_FRAME_BYTES; idx++)
+    {
+        IoExp_TxFrame[idx] = ((idx + IoExpOutputBytes) < IOEXP_FRAME_BYTES) ? 0U : IoExp_OutputImage[IOEXP_FRAME_BYTES - 1U - idx];
+    }
+
+    // Parallel load pulse
+    Dio_WriteChannelFast(IoExpLoadChannel, STD_LOW);
+    Dio_WriteChannelFast(IoExpLoadChannel, STD_HIGH);
+
+    ret = Spi_SetupEB(IoExpSpiChannel, IoExp_TxFrame, IoExp_RxFrame, IOEXP_FRAME_BYTES);
+    if (ret == E_OK)
+    {
+        ret = Spi_SyncTransmit(IoExpSpiSeq);
+    }
+
+    if (ret == E_OK)
+    {
+        // Latch pulse
+        Dio_WriteChannelFast(IoExpLatchChannel, STD_HIGH);
+        Dio_WriteChannelFast(IoExpLatchChannel, STD_LOW);
+
+        // Closest 165 comes out first
+        for (idx = 0; idx < IoExpInputBytes; idx++)
+        {
+            IoExp_InputImage[idx] = IoExp_RxFrame[idx];
+        }
+    }
+    else
+    {
+        IoExp_Dirty = TRUE;
+    }
+    return ret;
+}
+
+/**
+ * @name : IoExp_MainFunction
+ * @param: NONE
+ * @Description: Cyclic refresh: every cycle when inputs are fitted (sampling), 
+ *               otherwise only when outputs changed.
+ **/
+void IoExp_MainFunction(void)
+{
+    if (IoExp_Initialized == TRUE)
+    {
+        if (IoExpInputBytes > 0U || IoExp_Dirty == TRUE)
+        {
+            (void)IoExp_Refresh();
+        }
+    }
+    return;
+}
@@ -0,0 +1,57 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : IoExp.h                                                  */
+/* Note      : 74HC595 / 74HC165 chains on SPI seen as DIO channels.    */
+/*             Dio_ReadChannel / Dio_WriteChannel route the virtual     */
+/*             channels here when DioIoExpanderSupport is TRUE.         */
+/************************************************************************/
+
+#ifndef IOEXP_H
+#define IOEXP_H
+
+#include "STD_TYPES.h"
+#include "DIO.h"
+#include "IoExp_Cfg.h"
+
+/************************************************************************/
+/*                          Published Info                              */
+/************************************************************************/
+
+#define IOEXP_ModuleId                  (202U)
+#define IOEXP_VendorId                  (483U)
+
+#define IOEXP_SW_MAJOR_VERSION          (1U)
+#define IOEXP_SW_MINOR_VERSION          (0U)
+#define IOEXP_SW_PATCH_VERSION          (0U)
+
+/************************************************************************/
+/*                                DET                                   */
+/************************************************************************/
+#define IOEXP_E_PARAM_CHANNEL           0x0A
+#define IOEXP_E_UNINIT                  0x05
+
+/************************************************************************/
+/*                         Module Constants                             */
+/************************************************************************/
+
+#define IOEXP_CHANNEL_END               (IOEXP_IN_CHANNEL(8U * IoExpInputBytes))
+
+/************************************************************************/
+/*                      Functions Declaration                           */
+/************************************************************************/
+
+void IoExp_Init( void );
+
+void IoExp_WriteChannel( Dio_ChannelType ChannelId, Dio_LevelType Level );
+
+Dio_LevelType IoExp_ReadChannel( Dio_ChannelType ChannelId );
+
+Std_ReturnType IoExp_Flush( void );
+
+Std_ReturnType IoExp_Refresh( void );
+
+void IoExp_MainFunction( void );
+
+#endif // EOF
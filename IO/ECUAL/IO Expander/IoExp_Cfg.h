@@ -0,0 +1,49 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : IoExp_Cfg.h                                              */
+/************************************************************************/
+
+#ifndef IOEXP_CFG_H
+#define IOEXP_CFG_H
+
+#include "DIO_cfg.h"
+
+// IoExp General Container
+
+// Switches the development error detection and notification on or off.
+#define IoExpDevErrorDetect
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Chain lengths, one byte per device (0 if the chain isn't fitted)
+#define IoExpOutputBytes                2U      // 74HC595 chain on MOSI
+#define IoExpInputBytes                 2U      // 74HC165 chain on MISO
+
+/*  Virtual channel IDs, placed after DIO_CHANNEL_C15
+    Outputs: IoExpChannelOffset ~ + 8 * IoExpOutputBytes - 1
+    Inputs : following the outputs, 8 * IoExpInputBytes channels
+    Bit 0 of byte 0 is the device closest to the MCU on both chains.
+*/
+#define IoExpChannelOffset              48U
+#define IOEXP_OUT_CHANNEL(n)            (IoExpChannelOffset + (n))
+#define IOEXP_IN_CHANNEL(n)             (IoExpChannelOffset + (8U * IoExpOutputBytes) + (n))
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Spi binding
+
+// EB channel, 8 bit, MSB first (QH of the 165 / QH' side of the 595 first)
+#define IoExpSpiChannel                 8U
+
+// Sequence holding one job [IoExpSpiChannel], SPI_CS_VIA_USER
+#define IoExpSpiSeq                     8U
+
+// 74HC595 RCLK: rising edge copies the shift registers to the outputs
+#define IoExpLatchChannel               DIO_CHANNEL_B0
+
+// 74HC165 SH/LD: low loads the inputs in parallel, high shifts
+#define IoExpLoadChannel                DIO_CHANNEL_B1
+
+#endif
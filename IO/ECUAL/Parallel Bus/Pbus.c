@@ -0,0 +1,368 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : Pbus.c                                                   */
+/************************************************************************/
+
+// Pbus_Init computes the data port BSRR word of every bus value once
+// (set bits in the low half, cleared bits in the high half), so putting
+// a word on the bus is a table load and one store, whatever was on the
+// bus before. When WR is on the data port, its falling edge is part of
+// the same store and a word costs two stores: data + WR low, WR high.
+// 16 bit buses use four nibble tables instead of a 65536 entry table.
+
+#include "det.h"
+#include "DIO.h"
+#include "Port.h"
+#include "hw_reg.h"
+#include "spi_Cfg.h"
+#include "Tft_Cfg.h"
+#include "Sd_Cfg.h"
+#include "IoExp_Cfg.h"
+#include "Deb_Cfg.h"
+#include "Pbus.h"
+
+/************************************************************************/
+/*                          Global Constants                            */
+/************************************************************************/
+#define Pbus_ApiID_Pbus_Write 0x01
+#define Pbus_ApiID_Pbus_WriteRepeat 0x02
+#define Pbus_ApiID_Pbus_Read 0x03
+#define Pbus_ApiID_Pbus_WriteCommand 0x04
+
+#if ((PbusDataOffset + PbusDataWidth) > 16U) || ((PbusDataWidth != 8U) && (PbusDataWidth != 16U))
+#error "Pbus: the data bus must be 8 or 16 channels of one port"
+#endif
+
+#if DioDisplayFrontEnd != DIO_DISPLAY_PBUS
+#error "Pbus: the display connector is assigned to Hmi (DioDisplayFrontEnd, DIO_cfg.h)"
+#endif
+
+// Bus pins of a port (data, WR, RD, CS, DC)
+#define PBUS_PORT_PINS(PortId)                                                                   \
+    ((((PortId) == PbusDataPort) ? (((1UL << PbusDataWidth) - 1UL) << PbusDataOffset) : 0UL) |   \
+     DIO_PORT_PIN_BIT((PortId), PbusWrChannel) | DIO_PORT_PIN_BIT((PortId), PbusRdChannel) |     \
+     DIO_PORT_PIN_BIT((PortId), PbusCsChannel) | DIO_PORT_PIN_BIT((PortId), PbusDcChannel))
+
+// Pins of a port driven or read by the other modules
+#define PBUS_OTHER_PINS(PortId)                                                                  \
+    (DIO_PORT_PIN_BIT((PortId), DIO_CHANNEL_A5) | DIO_PORT_PIN_BIT((PortId), DIO_CHANNEL_A6) |   \
+     DIO_PORT_PIN_BIT((PortId), DIO_CHANNEL_A7) |                /* SPI1 SCK, MISO, MOSI */      \
+     (((PortId) == SpiCsDecoderPort) ? SpiCsDecoderMask : 0UL) |                                 \
+     DIO_PORT_PIN_BIT((PortId), SpiCsDecoderEnableChannel) |                                     \
+     DIO_PORT_PIN_BIT((PortId), TftCsChannel) | DIO_PORT_PIN_BIT((PortId), TftDcChannel) |       \
+     DIO_PORT_PIN_BIT((PortId), SdCsChannel) |                                                   \
+     DIO_PORT_PIN_BIT((PortId), IoExpLatchChannel) | DIO_PORT_PIN_BIT((PortId), IoExpLoadChannel) | \
+     (((PortId) == DIO_PORTTYPE_PORTA) ? (DebPortAMask | DioEventRisingMaskPortA | DioEventFallingMaskPortA) : \
+      ((PortId) == DIO_PORTTYPE_PORTB) ? (DebPortBMask | DioEventRisingMaskPortB | DioEventFallingMaskPortB) : \
+                                         (DebPortCMask | DioEventRisingMaskPortC | DioEventFallingMaskPortC)))
+
+// Pbus_Read turns the data pins to GPIO inputs and back: a shared pin would lose its function
+#if ((PBUS_PORT_PINS(DIO_PORTTYPE_PORTA) & PBUS_OTHER_PINS(DIO_PORTTYPE_PORTA)) != 0UL) || \
+    ((PBUS_PORT_PINS(DIO_PORTTYPE_PORTB) & PBUS_OTHER_PINS(DIO_PORTTYPE_PORTB)) != 0UL) || \
+    ((PBUS_PORT_PINS(DIO_PORTTYPE_PORTC) & PBUS_OTHER_PINS(DIO_PORTTYPE_PORTC)) != 0UL)
+#error "Pbus: a bus pin is used by another module (SPI1, CS decoder, Tft, Sd, IoExp, Deb, DioEvt)"
+#endif
+
+// First channel of the data port, used to address its registers
+#define PBUS_DATA_CHANNEL (PbusDataPort * 16U)
+
+#define PBUS_DATA_BSRR DIO_CHANNEL_REG(PBUS_DATA_CHANNEL, GPIO_BSRR_OFFSET)
+#define PBUS_DATA_IDR DIO_CHANNEL_REG(PBUS_DATA_CHANNEL, GPIO_IDR_OFFSET)
+
+#define PBUS_DATA_MASK ((uint32)((1UL << PbusDataWidth) - 1UL) << PbusDataOffset)
+
+// WR falling edge merged into the data store
+#define PBUS_WR_ON_DATA_PORT ((PbusWrChannel >> 4) == PbusDataPort)
+#define PBUS_WR_LOW_BITS (PBUS_WR_ON_DATA_PORT ? (DIO_CHANNEL_MASK(PbusWrChannel) << 16) : 0UL)
+
+#if PbusDataWidth == 16U
+#define PBUS_NIBBLES 4U
+#endif
+
+#define PBUS_DELAY(Loops)                              \
+    do                                                 \
+    {                                                  \
+        volatile uint32 delay;                         \
+        for (delay = 0; delay < (Loops); delay++)      \
+        {                                              \
+        }                                              \
+    } while (0)
+
+#if PbusSetupLoops > 0U
+#define PBUS_SETUP_DELAY() PBUS_DELAY(PbusSetupLoops)
+#else
+#define PBUS_SETUP_DELAY()
+#endif
+
+#if PbusHoldLoops > 0U
+#define PBUS_HOLD_DELAY() PBUS_DELAY(PbusHoldLoops)
+#else
+#define PBUS_HOLD_DELAY()
+#endif
+
+#if PbusReadAccessLoops > 0U
+#define PBUS_ACCESS_DELAY() PBUS_DELAY(PbusReadAccessLoops)
+#else
+#define PBUS_ACCESS_DELAY()
+#endif
+
+/************************************************************************/
+/*                          Local functions                             */
+/************************************************************************/
+LOCAL_INLINE uint32 Pbus_StaticDataWord(Pbus_DataType Value);
+LOCAL_INLINE void Pbus_StaticStrobe(uint32 BsrrWord);
+#ifdef PbusReadApi
+static void Pbus_StaticSetDataDirection(Port_PinDirectionType Direction);
+#endif
+
+/************************************************************************/
+/*                         Global variables                             */
+/************************************************************************/
+static boolean Pbus_Initialized = FALSE;
+
+// Data port BSRR word of every bus value, WR low bit included
+#if PbusDataWidth == 16U
+static uint32 Pbus_DataTable[PBUS_NIBBLES][16];
+#else
+static uint32 Pbus_DataTable[256];
+#endif
+
+/************************************************************************/
+/*                         APIS definitions                             */
+/************************************************************************/
+/**
+ * @name : Pbus_Init
+ * @param: NONE
+ * Non Reentrant
+ * Sync
+ * Builds the BSRR tables and puts the strobes in their idle state.
+ * Note: The data and strobe pins are configured as outputs by Port_Init.
+ **/
+void Pbus_Init(void)
+{
+    uint32 setBits = 0;
+    uint32 idx = 0;
+#if PbusDataWidth == 16U
+    uint8 nibble = 0;
+    uint32 nibbleMask = 0;
+
+    for (nibble = 0; nibble < PBUS_NIBBLES; nibble++)
+    {
+        nibbleMask = 0x0FUL << (PbusDataOffset + (4U * nibble));
+        for (idx = 0; idx < 16U; idx++)
+        {
+            setBits = idx << (PbusDataOffset + (4U * nibble));
+            Pbus_DataTable[nibble][idx] = setBits | ((setBits ^ nibbleMask) << 16);
+        }
+    }
+    for (idx = 0; idx < 16U; idx++)
+    {
+        Pbus_DataTable[0][idx] |= PBUS_WR_LOW_BITS;
+    }
+#else
+    for (idx = 0; idx < 256U; idx++)
+    {
+        setBits = idx << PbusDataOffset;
+        Pbus_DataTable[idx] = setBits | ((setBits ^ PBUS_DATA_MASK) << 16) | PBUS_WR_LOW_BITS;
+    }
+#endif
+    Dio_WriteChannelFast(PbusCsChannel, STD_HIGH);
+    Dio_WriteChannelFast(PbusWrChannel, STD_HIGH);
+    Dio_WriteChannelFast(PbusRdChannel, STD_HIGH);
+    Dio_WriteChannelFast(PbusDcChannel, STD_HIGH);
+
+    Pbus_Initialized = TRUE;
+    return;
+}
+
+/**
+ * @name : Pbus_WriteCommand
+ * @param: Command: word written with DC low
+ * Non Reentrant
+ * Sync
+ **/
+void Pbus_WriteCommand(Pbus_DataType Command)
+{
+#ifdef PbusDevErrorDetect
+    if (Pbus_Initialized == FALSE)
+    {
+        Det_ReportError(PBUS_ModuleId, 0, Pbus_ApiID_Pbus_WriteCommand, PBUS_E_UNINIT);
+        return;
+    }
+#endif
+    Dio_WriteChannelFast(PbusDcChannel, STD_LOW);
+    Dio_WriteChannelFast(PbusCsChannel, STD_LOW);
+    Pbus_StaticStrobe(Pbus_StaticDataWord(Command));
+    Dio_WriteChannelFast(PbusCsChannel, STD_HIGH);
+    Dio_WriteChannelFast(PbusDcChannel, STD_HIGH);
+    return;
+}
+
+/**
+ * @name : Pbus_Write
+ * @param: BufferPtr: words to write (DC high)
+ *         Count: number of words
+ * Non Reentrant
+ * Sync
+ * Streams the buffer with one table load and two (WR on the data port)
+ * or three stores per word.
+ **/
+void Pbus_Write(const Pbus_DataType *BufferPtr, uint32 Count)
+{
+    uint32 idx = 0;
+
+#ifdef PbusDevErrorDetect
+    if (Pbus_Initialized == FALSE)
+    {
+        Det_ReportError(PBUS_ModuleId, 0, Pbus_ApiID_Pbus_Write, PBUS_E_UNINIT);
+        return;
+    }
+    if (BufferPtr == NULL_PTR)
+    {
+        Det_ReportError(PBUS_ModuleId, 0, Pbus_ApiID_Pbus_Write, PBUS_E_PARAM_POINTER);
+        return;
+    }
+#endif
+    Dio_WriteChannelFast(PbusCsChannel, STD_LOW);
+    for (idx = 0; idx < Count; idx++)
+    {
+        Pbus_StaticStrobe(Pbus_StaticDataWord(BufferPtr[idx]));
+    }
+    Dio_WriteChannelFast(PbusCsChannel, STD_HIGH);
+    return;
+}
+
+/**
+ * @name : Pbus_WriteRepeat
+ * @param: Value: word to write (DC high)
+ *         Count: number of times
+ * Non Reentrant
+ * Sync
+ * The data is put on the bus once, only WR toggles after (area fills).
+ **/
+void Pbus_WriteRepeat(Pbus_DataType Value, uint32 Count)
+{
+    uint32 idx = 0;
+
+#ifdef PbusDevErrorDetect
+    if (Pbus_Initialized == FALSE)
+    {
+        Det_ReportError(PBUS_ModuleId, 0, Pbus_ApiID_Pbus_WriteRepeat, PBUS_E_UNINIT);
+        return;
+    }
+#endif
+    if (Count == 0)
+    {
+        return;
+    }
+    Dio_WriteChannelFast(PbusCsChannel, STD_LOW);
+    Pbus_StaticStrobe(Pbus_StaticDataWord(Value));
+    for (idx = 1; idx < Count; idx++)
+    {
+        Dio_WriteChannelFast(PbusWrChannel, STD_LOW);
+        PBUS_SETUP_DELAY();
+        Dio_WriteChannelFast(PbusWrChannel, STD_HIGH);
+        PBUS_HOLD_DELAY();
+    }
+    Dio_WriteChannelFast(PbusCsChannel, STD_HIGH);
+    return;
+}
+
+#ifdef PbusReadApi
+/**
+ * @name : Pbus_Read
+ * @param: BufferPtr: received words
+ *         Count: number of words
+ * Non Reentrant
+ * Sync
+ * Burst read (DC high): the data pins are inputs for the whole burst,
+ * one RD strobe and one IDR load per word.
+ **/
+void Pbus_Read(Pbus_DataType *BufferPtr, uint32 Count)
+{
+    uint32 idx = 0;
+
+#ifdef PbusDevErrorDetect
+    if (Pbus_Initialized == FALSE)
+    {
+        Det_ReportError(PBUS_ModuleId, 0, Pbus_ApiID_Pbus_Read, PBUS_E_UNINIT);
+        return;
+    }
+    if (BufferPtr == NULL_PTR)
+    {
+        Det_ReportError(PBUS_ModuleId, 0, Pbus_ApiID_Pbus_Read, PBUS_E_PARAM_POINTER);
+        return;
+    }
+#endif
+    Pbus_StaticSetDataDirection(PbusDataInputDirection);
+    Dio_WriteChannelFast(PbusCsChannel, STD_LOW);
+    for (idx = 0; idx < Count; idx++)
+    {
+        Dio_WriteChannelFast(PbusRdChannel, STD_LOW);
+        PBUS_ACCESS_DELAY();
+        BufferPtr[idx] = (Pbus_DataType)((PBUS_DATA_IDR & PBUS_DATA_MASK) >> PbusDataOffset);
+        Dio_WriteChannelFast(PbusRdChannel, STD_HIGH);
+        PBUS_HOLD_DELAY();
+    }
+    Dio_WriteChannelFast(PbusCsChannel, STD_HIGH);
+    Pbus_StaticSetDataDirection(PbusDataOutputDirection);
+    return;
+}
+#endif
+
+/************************************************************************/
+/*                    Local functions Definitions                       */
+/************************************************************************/
+
+/**
+ * @name : Pbus_StaticDataWord
+ * @param: Value: bus word
+ * @Return: data port BSRR word (with WR low when WR is on the data port)
+ **/
+LOCAL_INLINE uint32 Pbus_StaticDataWord(Pbus_DataType Value)
+{
+#if PbusDataWidth == 16U
+    return Pbus_DataTable[0][Value & 0x0FU] | Pbus_DataTable[1][(Value >> 4) & 0x0FU] |
+           Pbus_DataTable[2][(Value >> 8) & 0x0FU] | Pbus_DataTable[3][Value >> 12];
+#else
+    return Pbus_DataTable[Value];
+#endif
+}
+
+/**
+ * @name : Pbus_StaticStrobe
+ * @param: BsrrWord: from Pbus_StaticDataWord
+ * @Description: puts the word on the bus and clocks it with a WR pulse,
+ *               the device latches on the WR rising edge.
+ **/
+LOCAL_INLINE void Pbus_StaticStrobe(uint32 BsrrWord)
+{
+    PBUS_DATA_BSRR = BsrrWord;
+    if (PBUS_WR_ON_DATA_PORT == FALSE)
+    {
+        Dio_WriteChannelFast(PbusWrChannel, STD_LOW);
+    }
+    PBUS_SETUP_DELAY();
+    Dio_WriteChannelFast(PbusWrChannel, STD_HIGH);
+    PBUS_HOLD_DELAY();
+    return;
+}
+
+#ifdef PbusReadApi
+/**
+ * @name : Pbus_StaticSetDataDirection
+ * @param: Direction: direction of every data pin
+ **/
+static void Pbus_StaticSetDataDirection(Port_PinDirectionType Direction)
+{
+    uint8 pin = 0;
+
+    for (pin = 0; pin < PbusDataWidth; pin++)
+    {
+        Port_SetPinDirection((Port_PinType)(PBUS_DATA_CHANNEL + PbusDataOffset + pin), Direction);
+    }
+    return;
+}
+#endif
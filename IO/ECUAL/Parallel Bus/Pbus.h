@@ -0,0 +1,61 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : Pbus.h                                                   */
+/* Note      : 8080 style parallel bus (LCD controllers, FIFOs) driven  */
+/*             through precomputed BSRR words of the data port.         */
+/************************************************************************/
+
+#ifndef PBUS_H
+#define PBUS_H
+
+#include "STD_TYPES.h"
+#include "DIO.h"
+#include "Pbus_Cfg.h"
+
+/************************************************************************/
+/*                          Published Info                              */
+/************************************************************************/
+
+#define PBUS_ModuleId                   (204U)
+#define PBUS_VendorId                   (483U)
+
+#define PBUS_SW_MAJOR_VERSION           (1U)
+#define PBUS_SW_MINOR_VERSION           (0U)
+#define PBUS_SW_PATCH_VERSION           (0U)
+
+/************************************************************************/
+/*                                DET                                   */
+/************************************************************************/
+#define PBUS_E_PARAM_POINTER            0x01
+#define PBUS_E_UNINIT                   0x05
+
+/************************************************************************/
+/*                         Type Definitions                             */
+/************************************************************************/
+
+// One bus word
+#if PbusDataWidth == 16U
+typedef uint16 Pbus_DataType;
+#else
+typedef uint8 Pbus_DataType;
+#endif
+
+/************************************************************************/
+/*                      Functions Declaration                           */
+/************************************************************************/
+
+void Pbus_Init( void );
+
+void Pbus_WriteCommand( Pbus_DataType Command );
+
+void Pbus_Write( const Pbus_DataType *BufferPtr, uint32 Count );
+
+void Pbus_WriteRepeat( Pbus_DataType Value, uint32 Count );
+
+#ifdef PbusReadApi
+    void Pbus_Read( Pbus_DataType *BufferPtr, uint32 Count );
+#endif
+
+#endif // EOF
@@ -0,0 +1,52 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : Pbus_Cfg.h                                               */
+/************************************************************************/
+
+#ifndef PBUS_CFG_H
+#define PBUS_CFG_H
+
+#include "DIO_cfg.h"
+#include "Port.h"
+
+// Pbus General Container
+
+// Switches the development error detection and notification on or off.
+#define PbusDevErrorDetect
+
+// Pbus_Read (data pins turned to inputs during the burst), needs PortSetPinDirectionApi
+#define PbusReadApi
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Data bus: PbusDataWidth adjoining channels of one port, from pin PbusDataOffset
+// Default: display connector (DioDisplayFrontEnd = DIO_DISPLAY_PBUS, DIO_cfg.h).
+// Pbus.c stops with #error if a bus pin is used by another module.
+#define PbusDataWidth                   8U                      // 8 or 16
+#define PbusDataPort                    DIO_PORTTYPE_PORTB
+#define PbusDataOffset                  8U                      // B8 ~ B15
+
+// Data pin directions while writing / reading.
+// Pbus_Read needs PortPinDirectionChangeable = STD_ON for the data pins.
+#define PbusDataOutputDirection         PORT_PIN_OUTPUT_PUSH_PULL_50MHZ
+#define PbusDataInputDirection          PORT_PIN_INPUT_FLOATING
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Strobes, all active low except DC (low = command, high = data).
+// A WR on the data port is merged with the data store (one store less per word).
+#define PbusWrChannel                   DIO_CHANNEL_A9
+#define PbusRdChannel                   DIO_CHANNEL_A10
+#define PbusCsChannel                   DIO_CHANNEL_A11
+#define PbusDcChannel                   DIO_CHANNEL_A12
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Timing, busy loop iterations (0: no delay, the store itself is the minimum)
+#define PbusSetupLoops                  0U      // data valid -> WR / RD rising edge
+#define PbusHoldLoops                   0U      // strobe high -> next data
+#define PbusReadAccessLoops             2U      // RD falling edge -> data valid
+
+#endif
@@ -0,0 +1,348 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : Tft.c                                                    */
+/************************************************************************/
+
+// The framebuffer is split in tiles, drawing marks tiles dirty. Tft_Flush
+// merges dirty tiles into rectangles (runs in a tile row, extended down
+// while the rows below have the same run dirty) and streams every
+// rectangle with one window setup and 16 bit pixel transfers taken
+// directly from the framebuffer.
+
+#include "det.h"
+#include "spi.h"
+#include "DIO.h"
+#include "Tft.h"
+
+/************************************************************************/
+/*                          Global Constants                            */
+/************************************************************************/
+#define Tft_ApiID_Tft_Init 0x00
+#define Tft_ApiID_Tft_WriteCommand 0x01
+#define Tft_ApiID_Tft_Invalidate 0x02
+#define Tft_ApiID_Tft_Flush 0x03
+
+#define TFT_TILE_COLUMNS ((TftWidth + TftTileWidth - 1U) / TftTileWidth)
+#define TFT_TILE_ROWS ((TftHeight + TftTileHeight - 1U) / TftTileHeight)
+
+/************************************************************************/
+/*                          Local functions                             */
+/************************************************************************/
+static Std_ReturnType Tft_StaticCommand(uint8 Command, const uint8 *ParamPtr, uint8 ParamLength);
+static Std_ReturnType Tft_StaticSendRect(Tft_CoordType X, Tft_CoordType Y, Tft_CoordType Width, Tft_CoordType Height);
+static uint8 Tft_StaticLowestSetBit(uint32 Value);
+
+/************************************************************************/
+/*                         Global variables                             */
+/************************************************************************/
+static const Tft_ConfigType *Tft_ConfigPtr = NULL_PTR;
+
+// One bit per tile, one word per tile row
+static uint32 Tft_DirtyTiles[TFT_TILE_ROWS];
+
+// Bytes sent on the bus by the last Tft_Flush
+static uint32 Tft_FrameBytes = 0;
+
+// Command byte buffer
+static uint8 Tft_CmdByte = 0;
+
+/************************************************************************/
+/*                         APIS definitions                             */
+/************************************************************************/
+/**
+ * @name : Tft_Init
+ * @param: ConfigPtr: Pointer to configuration set.
+ * Non Reentrant
+ * Sync
+ * Initializes the module, the whole framebuffer is marked dirty.
+ * Note: The panel power-up sequence (reset, sleep out, pixel format 0x55,
+ *       display on) is sent by the application with Tft_WriteCommand.
+ **/
+void Tft_Init(const Tft_ConfigType *ConfigPtr)
+{
+#ifdef TftDevErrorDetect
+    if (ConfigPtr == NULL_PTR || ConfigPtr->TftFramebufferPtr == NULL_PTR)
+    {
+        Det_ReportError(TFT_ModuleId, 0, Tft_ApiID_Tft_Init, TFT_E_PARAM_CONFIG);
+        return;
+    }
+#endif
+    Tft_ConfigPtr = ConfigPtr;
+    Tft_FrameBytes = 0;
+    Tft_Invalidate(0, 0, TftWidth, TftHeight);
+    return;
+}
+
+/**
+ * @name : Tft_WriteCommand
+ * @param: Command: Panel command
+ *         ParamPtr: Command parameters, NULL_PTR if none
+ *         ParamLength: Number of parameters
+ * Non Reentrant
+ * Sync
+ * @Return: E_OK: command sent
+ *          E_NOT_OK: bus busy
+ **/
+Std_ReturnType Tft_WriteCommand(uint8 Command, const uint8 *ParamPtr, uint8 ParamLength)
+{
+    Std_ReturnType ret = E_OK;
+#ifdef TftDevErrorDetect
+    if (ParamLength != 0 && ParamPtr == NULL_PTR)
+    {
+        Det_ReportError(TFT_ModuleId, 0, Tft_ApiID_Tft_WriteCommand, TFT_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+#endif
+    Dio_WriteChannelFast(TftCsChannel, STD_LOW);
+    ret = Tft_StaticCommand(Command, ParamPtr, ParamLength);
+    Dio_WriteChannelFast(TftCsChannel, STD_HIGH);
+    return ret;
+}
+
+/**
+ * @name : Tft_Invalidate
+ * @param: X, Y: Top left corner of the changed area
+ *         Width, Height: Size of the changed area
+ * Reentrant
+ * Sync
+ * @Description: Marks the tiles covering the area dirty, called after drawing into the framebuffer.
+ **/
+void Tft_Invalidate(Tft_CoordType X, Tft_CoordType Y, Tft_CoordType Width, Tft_CoordType Height)
+{
+    uint8 row = 0;
+    uint8 colFirst = 0;
+    uint8 colLast = 0;
+    uint32 mask = 0;
+
+#ifdef TftDevErrorDetect
+    if (Width == 0 || Height == 0 || X >= TftWidth || Y >= TftHeight)
+    {
+        Det_ReportError(TFT_ModuleId, 0, Tft_ApiID_Tft_Invalidate, TFT_E_PARAM_AREA);
+        return;
+    }
+#endif
+    // Clip to the panel
+    if (Width > TftWidth - X)
+    {
+        Width = TftWidth - X;
+    }
+    if (Height > TftHeight - Y)
+    {
+        Height = TftHeight - Y;
+    }
+
+    colFirst = (uint8)(X / TftTileWidth);
+    colLast = (uint8)((X + Width - 1U) / TftTileWidth);
+    mask = ((uint8)(colLast - colFirst) >= 31U) ? 0xFFFFFFFFUL : (((1UL << (colLast - colFirst + 1U)) - 1UL) << colFirst);
+
+    for (row = (uint8)(Y / TftTileHeight); row <= (uint8)((Y + Height - 1U) / TftTileHeight); row++)
+    {
+        Tft_DirtyTiles[row] |= mask;
+    }
+    return;
+}
+
+/**
+ * @name : Tft_Flush
+ * @param: NONE
+ * Non Reentrant
+ * Sync
+ * @Return: E_OK: all dirty rectangles sent
+ *          E_NOT_OK: module not initialized or bus busy, nothing lost (sent again next flush)
+ * @Description: Streams the dirty areas of the framebuffer to the panel.
+ **/
+Std_ReturnType Tft_Flush(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 row = 0;
+    uint8 rowEnd = 0;
+    uint8 col = 0;
+    uint8 run = 0;
+    uint32 runMask = 0;
+
+#ifdef TftDevErrorDetect
+    if (Tft_ConfigPtr == NULL_PTR)
+    {
+        Det_ReportError(TFT_ModuleId, 0, Tft_ApiID_Tft_Flush, TFT_E_UNINIT);
+        return E_NOT_OK;
+    }
+#endif
+    if (Spi_GetStatus() != SPI_IDLE)
+    {
+        return E_NOT_OK;
+    }
+
+    Tft_FrameBytes = 0;
+    Dio_WriteChannelFast(TftCsChannel, STD_LOW);
+
+    for (row = 0; row < TFT_TILE_ROWS && ret == E_OK; row++)
+    {
+        while (Tft_DirtyTiles[row] != 0 && ret == E_OK)
+        {
+            // Lowest run of consecutive dirty tiles in this row
+            col = Tft_StaticLowestSetBit(Tft_DirtyTiles[row]);
+            run = Tft_StaticLowestSetBit(~(Tft_DirtyTiles[row] >> col));
+            runMask = ((run >= 32U) ? 0xFFFFFFFFUL : ((1UL << run) - 1UL)) << col;
+
+            // Extend down while the rows below have the same run dirty
+            Tft_DirtyTiles[row] &= ~runMask;
+            rowEnd = row;
+            while ((rowEnd + 1U) < TFT_TILE_ROWS && (Tft_DirtyTiles[rowEnd + 1U] & runMask) == runMask)
+            {
+                rowEnd++;
+                Tft_DirtyTiles[rowEnd] &= ~runMask;
+            }
+
+            ret = Tft_StaticSendRect((Tft_CoordType)(col * TftTileWidth),
+                                     (Tft_CoordType)(row * TftTileHeight),
+                                     (Tft_CoordType)(run * TftTileWidth),
+                                     (Tft_CoordType)((rowEnd - row + 1U) * TftTileHeight));
+        }
+    }
+
+    Dio_WriteChannelFast(TftCsChannel, STD_HIGH);
+
+    if (ret != E_OK)
+    {
+        // Panel content unknown, redraw everything next time
+        Tft_Invalidate(0, 0, TftWidth, TftHeight);
+    }
+    return ret;
+}
+
+/**
+ * @name : Tft_GetFrameBytes
+ * @param: NONE
+ * Reentrant
+ * Sync
+ * @Return: Bytes (commands, parameters and pixels) sent by the last Tft_Flush
+ **/
+uint32 Tft_GetFrameBytes(void)
+{
+    return Tft_FrameBytes;
+}
+
+/************************************************************************/
+/*                    Local functions Definitions                       */
+/************************************************************************/
+
+/**
+* @name : Tft_StaticCommand
+* @Description: Sends a command (DC low) and its parameters (DC high), CS asserted by the caller.
+**/
+static Std_ReturnType Tft_StaticCommand(uint8 Command, const uint8 *ParamPtr, uint8 ParamLength)
+{
+    Std_ReturnType ret = E_OK;
+
+    Tft_CmdByte = Command;
+    Dio_WriteChannelFast(TftDcChannel, STD_LOW);
+    ret = Spi_SetupEB(TftSpiChannelCommand, &Tft_CmdByte, NULL_PTR, 1);
+    if (ret == E_OK)
+    {
+        ret = Spi_SyncTransmit(TftSpiSeqCommand);
+    }
+    Dio_WriteChannelFast(TftDcChannel, STD_HIGH);
+
+    if (ret == E_OK && ParamLength != 0)
+    {
+        ret = Spi_SetupEB(TftSpiChannelCommand, ParamPtr, NULL_PTR, ParamLength);
+        if (ret == E_OK)
+        {
+            ret = Spi_SyncTransmit(TftSpiSeqCommand);
+        }
+    }
+    Tft_FrameBytes += 1U + ParamLength;
+    return ret;
+}
+
+/**
+* @name : Tft_StaticSendRect
+* @Description: Sets the panel window and streams the framebuffer area, clipped to the panel.
+**/
+static Std_ReturnType Tft_StaticSendRect(Tft_CoordType X, Tft_CoordType Y, Tft_CoordType Width, Tft_CoordType Height)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 params[4];
+    uint32 pixels = 0;
+    uint16 chunk = 0;
+    Tft_CoordType row = 0;
+    const Tft_PixelType *pixelPtr = NULL_PTR;
+
+    if (Width > TftWidth - X)
+    {
+        Width = TftWidth - X;
+    }
+    if (Height > TftHeight - Y)
+    {
+        Height = TftHeight - Y;
+    }
+
+    params[0] = (uint8)(X >> 8);
+    params[1] = (uint8)(X);
+    params[2] = (uint8)((X + Width - 1U) >> 8);
+    params[3] = (uint8)(X + Width - 1U);
+    ret = Tft_StaticCommand(TFT_CMD_COLUMN_ADDRESS_SET, params, 4);
+
+    params[0] = (uint8)(Y >> 8);
+    params[1] = (uint8)(Y);
+    params[2] = (uint8)((Y + Height - 1U) >> 8);
+    params[3] = (uint8)(Y + Height - 1U);
+    if (ret == E_OK)
+    {
+        ret = Tft_StaticCommand(TFT_CMD_ROW_ADDRESS_SET, params, 4);
+    }
+    if (ret == E_OK)
+    {
+        ret = Tft_StaticCommand(TFT_CMD_MEMORY_WRITE, NULL_PTR, 0);
+    }
+
+    // DC is high: pixel data
+    pixelPtr = &Tft_ConfigPtr->TftFramebufferPtr[((uint32)Y * TftWidth) + X];
+    if (Width == TftWidth)
+    {
+        // Full width rows are contiguous in the framebuffer
+        pixels = (uint32)Width * Height;
+        while (pixels > 0 && ret == E_OK)
+        {
+            chunk = (pixels < SpiEbMaxLength) ? (uint16)pixels : SpiEbMaxLength;
+            ret = Spi_SetupEB(TftSpiChannelPixels, (const Spi_DataBufferType *)pixelPtr, NULL_PTR, chunk);
+            if (ret == E_OK)
+            {
+                ret = Spi_SyncTransmit(TftSpiSeqPixels);
+            }
+            pixelPtr += chunk;
+            pixels -= chunk;
+        }
+    }
+    else
+    {
+        for (row = 0; row < Height && ret == E_OK; row++)
+        {
+            ret = Spi_SetupEB(TftSpiChannelPixels, (const Spi_DataBufferType *)pixelPtr, NULL_PTR, Width);
+            if (ret == E_OK)
+            {
+                ret = Spi_SyncTransmit(TftSpiSeqPixels);
+            }
+            pixelPtr += TftWidth;
+        }
+    }
+    Tft_FrameBytes += (uint32)Width * Height * sizeof(Tft_PixelType);
+    return ret;
+}
+
+/**
+* @name : Tft_StaticLowestSetBit
+* @Return: Index of the lowest set bit, 32 if Value is 0
+**/
+static uint8 Tft_StaticLowestSetBit(uint32 Value)
+{
+    uint8 idx = 0;
+
+    while (idx < 32U && ((Value >> idx) & 1UL) == 0)
+    {
+        idx++;
+    }
+    return idx;
+}
@@ -0,0 +1,74 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : Tft.h                                                    */
+/* Note      : Framebuffer streaming to ST7735 / ILI9341 class panels.  */
+/*             Only the dirty rectangles are sent on Tft_Flush.         */
+/************************************************************************/
+
+#ifndef TFT_H
+#define TFT_H
+
+#include "STD_TYPES.h"
+#include "Tft_Cfg.h"
+
+/************************************************************************/
+/*                          Published Info                              */
+/************************************************************************/
+
+#define TFT_ModuleId                    (201U)
+#define TFT_VendorId                    (483U)
+
+#define TFT_SW_MAJOR_VERSION            (1U)
+#define TFT_SW_MINOR_VERSION            (0U)
+#define TFT_SW_PATCH_VERSION            (0U)
+
+/************************************************************************/
+/*                                DET                                   */
+/************************************************************************/
+#define TFT_E_PARAM_CONFIG              0x01
+#define TFT_E_PARAM_AREA                0x02
+#define TFT_E_UNINIT                    0x05
+#define TFT_E_PARAM_POINTER             0x0A
+
+/************************************************************************/
+/*                         Module Constants                             */
+/************************************************************************/
+
+// MIPI DCS commands
+#define TFT_CMD_COLUMN_ADDRESS_SET      0x2A
+#define TFT_CMD_ROW_ADDRESS_SET         0x2B
+#define TFT_CMD_MEMORY_WRITE            0x2C
+
+/************************************************************************/
+/*                            Type Definitons                           */
+/************************************************************************/
+
+// RGB565 pixel
+typedef uint16 Tft_PixelType;
+
+// Pixel coordinate
+typedef uint16 Tft_CoordType;
+
+typedef struct
+{
+    // TftWidth * TftHeight pixels, row major, drawn by the application
+    Tft_PixelType *TftFramebufferPtr;
+}Tft_ConfigType;
+
+/************************************************************************/
+/*                      Functions Declaration                           */
+/************************************************************************/
+
+void Tft_Init( const Tft_ConfigType* ConfigPtr );
+
+Std_ReturnType Tft_WriteCommand( uint8 Command, const uint8* ParamPtr, uint8 ParamLength );
+
+void Tft_Invalidate( Tft_CoordType X, Tft_CoordType Y, Tft_CoordType Width, Tft_CoordType Height );
+
+Std_ReturnType Tft_Flush( void );
+
+uint32 Tft_GetFrameBytes( void );
+
+#endif // EOF
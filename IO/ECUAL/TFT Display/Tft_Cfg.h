@@ -0,0 +1,50 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : Tft_Cfg.h                                                */
+/************************************************************************/
+
+#ifndef TFT_CFG_H
+#define TFT_CFG_H
+
+#include "DIO_cfg.h"
+
+// Tft General Container
+
+// Switches the development error detection and notification on or off.
+#define TftDevErrorDetect
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Panel geometry (RGB565 pixels)
+// TftWidth must not exceed SpiEbMaxLength (one rectangle row per transfer)
+#define TftWidth                        128U
+#define TftHeight                       160U
+
+// Dirty tracking granularity
+// TftWidth / TftTileWidth must not exceed 32
+#define TftTileWidth                    16U
+#define TftTileHeight                   16U
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Spi binding, both jobs use SPI_CS_VIA_USER on the same HW unit
+
+// EB channel, 8 bit, MSB first: command byte and parameters
+#define TftSpiChannelCommand            6U
+
+// EB channel, 16 bit, MSB first: pixel data
+#define TftSpiChannelPixels             7U
+
+// Sequence holding one job [TftSpiChannelCommand]
+#define TftSpiSeqCommand                6U
+
+// Sequence holding one job [TftSpiChannelPixels]
+#define TftSpiSeqPixels                 7U
+
+// Panel chip select and data / command select
+#define TftCsChannel                    DIO_CHANNEL_A4
+#define TftDcChannel                    DIO_CHANNEL_A3
+
+#endif
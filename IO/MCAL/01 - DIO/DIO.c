@@ -10,10 +10,10 @@
 #include "DIO.h"
 #include "hw_reg.h"
 #include "det.h"
+#if DioIoExpanderSupport == TRUE
+#include "IoExp.h"
+#endif
 
-#define PORTA_CHANNEL_OFFEST (0U)
-#define PORTB_CHANNEL_OFFEST (16U)
-#define PORTC_CHANNEL_OFFEST (32U)
 #define PORTx_CHANNEL_OFFSET (48U)
 
 /***    API ID    ***/
@@ -25,20 +25,80 @@
 #define DIO_ApiID_WriteChannelGroup 0x05
 #define DIO_ApiID_FlipChannel 0x11
 #define DIO_ApiID_GetVersionInfo 0x12
+#define DIO_ApiID_WriteChannels 0x13
+#define DIO_ApiID_WriteChannelSet 0x14
+#define DIO_ApiID_ReadChannelSet 0x15
+
+#define DIO_PORT_NUM (3U)
+#define DIO_PORT_MASK (0xFFFFUL)
 
 //      Local Type Def
 /**
- * Numeric ID of a DIO channel. 
- * Values: Dio_ModeInput - Dio_ModeOutput      
+ * GPIO register block, same layout as GPIOx_CRL ~ GPIOx_LCKR in hw_reg.h
+ **/
+typedef struct
+{
+    volatile uint32 CRL;
+    volatile uint32 CRH;
+    volatile uint32 IDR;
+    volatile uint32 ODR;
+    volatile uint32 BSRR;
+    volatile uint32 BRR;
+    volatile uint32 LCKR;
+} Dio_GpioRegType;
+
+/**
+ * Channel descriptor: register block of the channel port and the channel bit,
+ * with DioBitBandAccess also the bit-band alias words of its IDR and ODR bits
  **/
-typedef boolean DIO_modeType;
+typedef struct
+{
+    Dio_GpioRegType *Port;
+    uint32 Mask;
+#if DioBitBandAccess == TRUE
+    volatile uint32 *IdrBit;
+    volatile uint32 *OdrBit;
+#endif
+} Dio_ChannelDescType;
+
+#define DIO_GPIO(PortNum) ((Dio_GpioRegType *)(GPIOA_BASE + ((PortNum) * GPIO_PORT_STRIDE)))
+
+#if DioBitBandAccess == TRUE
+#define DIO_GPIO_BIT(PortNum, Pin, Offset) \
+    ((volatile uint32 *)BITBAND_PERIPH(GPIOA_BASE + ((PortNum) * GPIO_PORT_STRIDE) + (Offset), (Pin)))
+
+#define DIO_CHANNEL(PortNum, Pin)                      \
+    {DIO_GPIO(PortNum), (1UL << (Pin)),                \
+     DIO_GPIO_BIT(PortNum, Pin, GPIO_IDR_OFFSET),      \
+     DIO_GPIO_BIT(PortNum, Pin, GPIO_ODR_OFFSET)}
+#else
+#define DIO_CHANNEL(PortNum, Pin) {DIO_GPIO(PortNum), (1UL << (Pin))}
+#endif
+
+#define DIO_PORT_CHANNELS(PortNum)                                                     \
+    DIO_CHANNEL(PortNum, 0), DIO_CHANNEL(PortNum, 1), DIO_CHANNEL(PortNum, 2),         \
+    DIO_CHANNEL(PortNum, 3), DIO_CHANNEL(PortNum, 4), DIO_CHANNEL(PortNum, 5),         \
+    DIO_CHANNEL(PortNum, 6), DIO_CHANNEL(PortNum, 7), DIO_CHANNEL(PortNum, 8),         \
+    DIO_CHANNEL(PortNum, 9), DIO_CHANNEL(PortNum, 10), DIO_CHANNEL(PortNum, 11),       \
+    DIO_CHANNEL(PortNum, 12), DIO_CHANNEL(PortNum, 13), DIO_CHANNEL(PortNum, 14),      \
+    DIO_CHANNEL(PortNum, 15)
 
-#define Dio_ModeInput 0x00
-#define Dio_ModeOutput 0x01
+/**
+ * Channel decode table, indexed by Dio_ChannelType:
+ * one table load gives the port and the bit of the channel
+ **/
+static const Dio_ChannelDescType Dio_ChannelDesc[PORTx_CHANNEL_OFFSET] =
+{
+    DIO_PORT_CHANNELS(DIO_PORTTYPE_PORTA),
+    DIO_PORT_CHANNELS(DIO_PORTTYPE_PORTB),
+    DIO_PORT_CHANNELS(DIO_PORTTYPE_PORTC)
+};
 
 /**** Local Functions *****/
 
-DIO_modeType Dio_GetChannelMode(Dio_ChannelType ChannelId);
+#if DioDevErrorDetect == TRUE
+static Std_ReturnType Dio_CheckChannelGroup(const Dio_ChannelGroupType *ChannelGroupIdPtr, uint8 ApiId);
+#endif
 
 /**
  * name : Dio_ReadChannel
@@ -50,64 +110,28 @@ DIO_modeType Dio_GetChannelMode(Dio_ChannelType ChannelId);
  **/
 Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 {
-    Dio_LevelType channelValue = 0;
-#if DioDevErrorDetect == TRUE
-    if (ChannelId >= PORTA_CHANNEL_OFFEST && ChannelId < PORTx_CHANNEL_OFFSET)
+    const Dio_ChannelDescType *Desc;
+#if DioIoExpanderSupport == TRUE
+    // Virtual channel: last snapshot of the expander
+    if (ChannelId >= IoExpChannelOffset)
     {
-        // OK proceed
-        if (ChannelId >= PORTA_CHANNEL_OFFEST &&
-            ChannelId < PORTB_CHANNEL_OFFEST)
-        {
-            channelValue = GET_BIT(GPIOA_IDR, ChannelId);
-        }
-        else if (ChannelId >= PORTB_CHANNEL_OFFEST &&
-                 ChannelId < PORTC_CHANNEL_OFFEST)
-        {
-            ChannelId -= PORTB_CHANNEL_OFFEST;
-            channelValue = GET_BIT(GPIOB_IDR, ChannelId);
-        }
-        else if (ChannelId >= PORTC_CHANNEL_OFFEST &&
-                 ChannelId < PORTx_CHANNEL_OFFSET)
-        {
-            ChannelId -= PORTC_CHANNEL_OFFEST;
-            channelValue = GET_BIT(GPIOC_IDR, ChannelId);
-        }
-        else
-        {
-            // Argument passing error
-            // shouldn't be here
-        }
+        return IoExp_ReadChannel(ChannelId);
     }
-    else
+#endif
+#if DioDevErrorDetect == TRUE
+    if (ChannelId >= PORTx_CHANNEL_OFFSET)
     {
         Det_ReportError(DIO_ModuleId, 0, DIO_ApiID_ReadChannel, DIO_E_PARAM_INVALID_CHANNEL_ID);
-        channelValue = 0;
+        return STD_LOW;
     }
+#endif
+    Desc = &Dio_ChannelDesc[ChannelId];
+#if DioBitBandAccess == TRUE
+    // alias word reads 0 or 1
+    return (Dio_LevelType)(*Desc->IdrBit);
 #else
-    if (ChannelId >= PORTA_CHANNEL_OFFEST &&
-        ChannelId < PORTB_CHANNEL_OFFEST)
-    {
-        channelValue = GET_BIT(GPIOA_IDR, ChannelId);
-    }
-    else if (ChannelId >= PORTB_CHANNEL_OFFEST &&
-             ChannelId < PORTC_CHANNEL_OFFEST)
-    {
-        ChannelId -= PORTB_CHANNEL_OFFEST;
-        channelValue = GET_BIT(GPIOB_IDR, ChannelId);
-    }
-    else if (ChannelId >= PORTC_CHANNEL_OFFEST &&
-             ChannelId < PORTx_CHANNEL_OFFSET)
-    {
-        ChannelId -= PORTC_CHANNEL_OFFEST;
-        channelValue = GET_BIT(GPIOC_IDR, ChannelId);
-    }
-    else
-    {
-        // Argument passing error
-        // shouldn't be here
-    }
+    return ((Desc->Port->IDR & Desc->Mask) != 0) ? STD_HIGH : STD_LOW;
 #endif
-    return channelValue;
 }
 
 /**
@@ -120,122 +144,41 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
  **/
 void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 {
-#if DioDevErrorDetect == TRUE
-    if (ChannelId >= PORTA_CHANNEL_OFFEST && ChannelId < PORTx_CHANNEL_OFFSET)
+    const Dio_ChannelDescType *Desc;
+#if DioIoExpanderSupport == TRUE
+    // Virtual channel: shadow image, shifted out by the next expander refresh
+    if (ChannelId >= IoExpChannelOffset)
     {
-        // OK proceed
-        /* 
-        * USE BSRR and BRR registers to provide atomic channel access 
-        */
-        if (ChannelId >= PORTA_CHANNEL_OFFEST &&
-            ChannelId < PORTB_CHANNEL_OFFEST)
-        {
-            switch (Level)
-            {
-            case STD_HIGH:
-                SET_BIT(GPIOA_BSRR, ChannelId); // Set Channel
-                break;
-            case STD_LOW:
-                SET_BIT(GPIOA_BRR, ChannelId); // Reset Channel
-                break;
-            default:
-                // shouldn't be here
-                break;
-            }
-        }
-        else if (ChannelId >= PORTB_CHANNEL_OFFEST &&
-                 ChannelId < PORTC_CHANNEL_OFFEST)
-        {
-            ChannelId -= PORTB_CHANNEL_OFFEST;
-            switch (Level)
-            {
-            case STD_HIGH:
-                SET_BIT(GPIOB_BSRR, ChannelId); // Set Channel
-                break;
-            case STD_LOW:
-                SET_BIT(GPIOB_BRR, ChannelId); // Reset Channel
-                break;
-            default:
-                // shouldn't be here
-                break;
-            }
-        }
-        else
-        {
-            ChannelId -= PORTC_CHANNEL_OFFEST;
-            switch (Level)
-            {
-            case STD_HIGH:
-                SET_BIT(GPIOC_BSRR, ChannelId); // Set Channel
-                break;
-            case STD_LOW:
-                SET_BIT(GPIOC_BRR, ChannelId); // Reset Channel
-                break;
-            default:
-                // shouldn't be here
-                break;
-            }
-        }
+        IoExp_WriteChannel(ChannelId, Level);
+        return;
     }
-    else
+#endif
+#if DioDevErrorDetect == TRUE
+    if (ChannelId >= PORTx_CHANNEL_OFFSET)
     {
         Det_ReportError(DIO_ModuleId, 0, DIO_ApiID_WriteChannel, DIO_E_PARAM_INVALID_CHANNEL_ID);
+        return;
     }
-#else
+#endif
     /* 
-     * USE BSRR and BRR registers to provide atomic channel access 
+     * USE BSRR and BRR registers to provide atomic channel access:
+     * a single store, no read of the port
      */
-    if (ChannelId >= PORTA_CHANNEL_OFFEST &&
-        ChannelId < PORTB_CHANNEL_OFFEST)
+    Desc = &Dio_ChannelDesc[ChannelId];
+#if DioBitBandAccess == TRUE
+    // the bus matrix turns the alias store into an atomic ODR bit write
+    *Desc->OdrBit = (Level == STD_HIGH) ? 1UL : 0UL;
+#else
+    if (Level == STD_HIGH)
     {
-        switch (Level)
-        {
-        case STD_HIGH:
-            SET_BIT(GPIOA_BSRR, ChannelId); // Set Channel
-            break;
-        case STD_LOW:
-            SET_BIT(GPIOA_BRR, ChannelId); // Reset Channel
-            break;
-        default:
-            // shouldn't be here
-            break;
-        }
-    }
-    else if (ChannelId >= PORTB_CHANNEL_OFFEST &&
-             ChannelId < PORTC_CHANNEL_OFFEST)
-    {
-        ChannelId -= PORTB_CHANNEL_OFFEST;
-        switch (Level)
-        {
-        case STD_HIGH:
-            SET_BIT(GPIOB_BSRR, ChannelId); // Set Channel
-            break;
-        case STD_LOW:
-            SET_BIT(GPIOB_BRR, ChannelId); // Reset Channel
-            break;
-        default:
-            // shouldn't be here
-            break;
-        }
+        Desc->Port->BSRR = Desc->Mask; // Set Channel
     }
     else
     {
-        ChannelId -= PORTC_CHANNEL_OFFEST;
-        switch (Level)
-        {
-        case STD_HIGH:
-            SET_BIT(GPIOC_BSRR, ChannelId); // Set Channel
-            break;
-        case STD_LOW:
-            SET_BIT(GPIOC_BRR, ChannelId); // Reset Channel
-            break;
-        default:
-            // shouldn't be here
-            break;
-        }
+        Desc->Port->BRR = Desc->Mask; // Reset Channel
     }
 #endif
-return ; 
+    return;
 }
 
 /**
@@ -381,26 +324,12 @@ void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level)
 Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType *ChannelGroupIdPtr)
 {
 #if DioDevErrorDetect == TRUE
-    // TODO
-#endif
-    Dio_PortLevelType subset_level;
-
-    switch (ChannelGroupIdPtr->port)
+    if (Dio_CheckChannelGroup(ChannelGroupIdPtr, DIO_ApiID_ReadChannelGroup) != E_OK)
     {
-    case DIO_PORTTYPE_PORTA:
-        subset_level = (GPIOA_IDR) & (ChannelGroupIdPtr->mask);
-        break;
-    case DIO_PORTTYPE_PORTB:
-        subset_level = (GPIOB_IDR) & (ChannelGroupIdPtr->mask);
-        break;
-    case DIO_PORTTYPE_PORTC:
-        subset_level = (GPIOC_IDR) & (ChannelGroupIdPtr->mask);
-        break;
-    default:
-        break;
+        return 0;
     }
-    subset_level = subset_level >> (ChannelGroupIdPtr->offset);
-    return subset_level;
+#endif
+    return (DIO_GPIO(ChannelGroupIdPtr->port)->IDR & ChannelGroupIdPtr->mask) >> ChannelGroupIdPtr->offset;
 }
 
 /**
@@ -413,33 +342,22 @@ Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType *ChannelGroupI
  **/
 void Dio_WriteChannelGroup(const Dio_ChannelGroupType *ChannelGroupIdPtr, Dio_PortLevelType Level)
 {
+    uint32 groupLevel = 0;
 
 #if DioDevErrorDetect == TRUE
-    // TODO
-#endif
-    uint32 subset_level = 0 ;
-
-    switch (ChannelGroupIdPtr->port)
+    if (Dio_CheckChannelGroup(ChannelGroupIdPtr, DIO_ApiID_WriteChannelGroup) != E_OK)
     {
-    case DIO_PORTTYPE_PORTA:
-        subset_level = (GPIOA_IDR) & (~ChannelGroupIdPtr->mask); // reset channel group bits
-        subset_level |= (Level << (ChannelGroupIdPtr->offset));  // assign chanel group value
-        GPIOA_IDR = subset_level;                                // write new value to register
-        break;
-    case DIO_PORTTYPE_PORTB:
-        subset_level = (GPIOB_IDR) & (~ChannelGroupIdPtr->mask); // reset channel group bits
-        subset_level |= (Level << (ChannelGroupIdPtr->offset));  // assign chanel group value
-        GPIOB_IDR = subset_level;                                // write new value to register
-        break;
-    case DIO_PORTTYPE_PORTC:
-        subset_level = (GPIOC_IDR) & (~ChannelGroupIdPtr->mask); // reset channel group bits
-        subset_level |= (Level << (ChannelGroupIdPtr->offset));  // assign chanel group value
-        GPIOC_IDR = subset_level;                                // write new value to register
-        break;
-    default:
-        break;
+        return;
     }
-    return ;
+#endif
+    /*
+     * One BSRR store: the group 1-bits in the set half (15:0), the group
+     * 0-bits in the reset half (31:16). Channels outside the group are
+     * untouched and no interrupt can slip in between a read and a write.
+     */
+    groupLevel = (Level << ChannelGroupIdPtr->offset) & ChannelGroupIdPtr->mask;
+    DIO_GPIO(ChannelGroupIdPtr->port)->BSRR = groupLevel | ((groupLevel ^ ChannelGroupIdPtr->mask) << 16);
+    return;
 }
 #if DioVersionInfoApi == TRUE
 /**
@@ -484,134 +402,210 @@ void Dio_GetVersionInfo(Std_VersionInfoType *VersionInfo)
      **/
 Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 {
-#if DioDevErrorDetect == TRUE
-    if (ChannelId >= PORTA_CHANNEL_OFFEST && ChannelId < PORTx_CHANNEL_OFFSET)
+    const Dio_ChannelDescType *Desc;
+    uint32 outputLevel = 0;
+#if DioIoExpanderSupport == TRUE
+    Dio_LevelType Level = STD_LOW;
+
+    // Virtual channel: flip the output image, inputs are only read
+    if (ChannelId >= IoExpChannelOffset)
     {
-        // OK proceed
+        Level = IoExp_ReadChannel(ChannelId);
+        if (ChannelId < IOEXP_IN_CHANNEL(0))
+        {
+            Level = (Level == STD_HIGH) ? STD_LOW : STD_HIGH;
+            IoExp_WriteChannel(ChannelId, Level);
+        }
+        return Level;
     }
-    else
+#endif
+
+#if DioDevErrorDetect == TRUE
+    if (ChannelId >= PORTx_CHANNEL_OFFSET)
     {
         Det_ReportError(DIO_ModuleId, 0, DIO_ApiID_FlipChannel, DIO_E_PARAM_INVALID_CHANNEL_ID);
-        return 0;
+        return STD_LOW;
     }
 #endif
+    Desc = &Dio_ChannelDesc[ChannelId];
 
-    Dio_LevelType ret_Level = 0;
-
-    if (Dio_GetChannelMode(ChannelId) == Dio_ModeInput)
+    // Direction from the Port shadow, no CRL/CRH decoding
+    if (Dio_IsChannelOutput(ChannelId) == FALSE)
     {
-        ret_Level = Dio_ReadChannel(ChannelId);
+        return ((Desc->Port->IDR & Desc->Mask) != 0) ? STD_HIGH : STD_LOW;
     }
-    else
-    {
-        if (Dio_ReadChannel(ChannelId) == STD_HIGH)
-        {
-            Dio_WriteChannel(ChannelId, STD_LOW);
-            ret_Level = STD_LOW;
-        }
-        else
-        {
-            Dio_WriteChannel(ChannelId, STD_HIGH);
-            ret_Level = STD_HIGH;
-        }
-    }
-    return ret_Level;
+    // set bit -> reset half, cleared bit -> set half: one ODR read, one BSRR store
+    outputLevel = Desc->Port->ODR & Desc->Mask;
+    Desc->Port->BSRR = (outputLevel << 16) | (outputLevel ^ Desc->Mask);
+    return (outputLevel != 0) ? STD_LOW : STD_HIGH;
 }
 #endif
 
-/***************** Local Functions definition **************/
-
-DIO_modeType Dio_GetChannelMode(Dio_ChannelType ChannelId)
+#if DioBatchApi == TRUE
+/**
+ * name : Dio_WriteChannels
+ * param: ChannelListPtr: channel / level pairs
+ *                 Count: number of pairs
+ * Reentrancy: Reentrant
+ * Sync
+ * Description: Writes all the listed channels with at most one BSRR store 
+ *      per port, so the outputs of a port change at the same time.
+ *      If a channel is listed twice the last level wins.
+ **/
+void Dio_WriteChannels(const Dio_ChannelLevelType *ChannelListPtr, uint8 Count)
 {
-    Dio_LevelType channelMode = 0;
-    if (ChannelId >= PORTA_CHANNEL_OFFEST &&
-        ChannelId < PORTB_CHANNEL_OFFEST)
+    uint32 portBsrr[DIO_PORT_NUM] = {0};
+    uint32 channelMask = 0;
+    uint8 idx = 0;
+    uint8 portNum = 0;
+    Dio_ChannelType channelId;
+
+#if DioDevErrorDetect == TRUE
+    if (ChannelListPtr == NULL_PTR)
     {
-        if (ChannelId < 8)
+        Det_ReportError(DIO_ModuleId, 0, DIO_ApiID_WriteChannels, DIO_E_PARAM_POINTER);
+        return;
+    }
+#endif
+    for (idx = 0; idx < Count; idx++)
+    {
+        channelId = ChannelListPtr[idx].ChannelId;
+#if DioIoExpanderSupport == TRUE
+        if (channelId >= IoExpChannelOffset)
         {
-            if ((GPIOA_CRL) & (0x0003 << (ChannelId * 4)) == 0x00)
-            {
-                channelMode = Dio_ModeInput;
-            }
-            else
-            {
-                channelMode = Dio_ModeOutput;
-            }
+            IoExp_WriteChannel(channelId, ChannelListPtr[idx].Level);
+            continue;
         }
-        else
+#endif
+#if DioDevErrorDetect == TRUE
+        if (channelId >= PORTx_CHANNEL_OFFSET)
         {
-            ChannelId -= 8;
-            if ((GPIOA_CRH) & (0x0003 << (ChannelId * 4)) == 0x00)
-            {
-                channelMode = Dio_ModeInput;
-            }
-            else
-            {
-                channelMode = Dio_ModeOutput;
-            }
+            Det_ReportError(DIO_ModuleId, 0, DIO_ApiID_WriteChannels, DIO_E_PARAM_INVALID_CHANNEL_ID);
+            continue;
         }
+#endif
+        portNum = channelId >> 4;
+        channelMask = Dio_ChannelDesc[channelId].Mask;
+        // drop an earlier request for the same channel
+        portBsrr[portNum] &= ~(channelMask | (channelMask << 16));
+        portBsrr[portNum] |= (ChannelListPtr[idx].Level == STD_HIGH) ? channelMask : (channelMask << 16);
     }
-    else if (ChannelId >= PORTB_CHANNEL_OFFEST &&
-             ChannelId < PORTC_CHANNEL_OFFEST)
+    for (portNum = 0; portNum < DIO_PORT_NUM; portNum++)
     {
-        ChannelId -= PORTB_CHANNEL_OFFEST;
-        if (ChannelId < 8)
+        if (portBsrr[portNum] != 0)
         {
-
-            if (GPIOB_CRL & (0x0003 << (ChannelId * 4)) == 0x00)
-            {
-                channelMode = Dio_ModeInput;
-            }
-            else
-            {
-                channelMode = Dio_ModeOutput;
-            }
-        }
-        else
-        {
-            ChannelId -= 8;
-            if (GPIOB_CRH & (0x0003 << (ChannelId * 4)) == 0x00)
-            {
-                channelMode = Dio_ModeInput;
-            }
-            else
-            {
-                channelMode = Dio_ModeOutput;
-            }
+            DIO_GPIO(portNum)->BSRR = portBsrr[portNum];
         }
     }
-    else if (ChannelId >= PORTC_CHANNEL_OFFEST &&
-             ChannelId < PORTx_CHANNEL_OFFSET)
+    return;
+}
+
+/**
+ * name : Dio_WriteChannelSet
+ * param: Channels: channels to write (DIO_CHANNEL_SET)
+ *          Levels: bit n = level of channel n, bits outside Channels ignored
+ * Reentrancy: Reentrant
+ * Sync
+ * Description: Writes a set of port pins, one BSRR store per involved port.
+ **/
+void Dio_WriteChannelSet(Dio_ChannelSetType Channels, Dio_ChannelSetType Levels)
+{
+    uint32 portChannels = 0;
+    uint32 portLevels = 0;
+    uint8 portNum = 0;
+
+#if DioDevErrorDetect == TRUE
+    if ((Channels >> PORTx_CHANNEL_OFFSET) != 0)
+    {
+        Det_ReportError(DIO_ModuleId, 0, DIO_ApiID_WriteChannelSet, DIO_E_PARAM_INVALID_CHANNEL_ID);
+        return;
+    }
+#endif
+    for (portNum = 0; portNum < DIO_PORT_NUM; portNum++)
     {
-        ChannelId -= PORTC_CHANNEL_OFFEST;
-        if (ChannelId < 8)
+        portChannels = (uint32)(Channels >> (portNum * 16U)) & DIO_PORT_MASK;
+        if (portChannels != 0)
         {
-            if (GPIOC_CRL & (0x0003 << (ChannelId * 4)) == 0x00)
-            {
-                channelMode = Dio_ModeInput;
-            }
-            else
-            {
-                channelMode = Dio_ModeOutput;
-            }
+            portLevels = (uint32)(Levels >> (portNum * 16U)) & portChannels;
+            DIO_GPIO(portNum)->BSRR = portLevels | ((portLevels ^ portChannels) << 16);
         }
-        else
+    }
+    return;
+}
+
+/**
+ * name : Dio_ReadChannelSet
+ * param: Channels: channels to read (DIO_CHANNEL_SET)
+ * Reentrancy: Reentrant
+ * Sync
+ * Return: bit n = level of channel n, 0 outside Channels
+ * Description: Reads a set of port pins, one IDR load per involved port.
+ **/
+Dio_ChannelSetType Dio_ReadChannelSet(Dio_ChannelSetType Channels)
+{
+    Dio_ChannelSetType levels = 0;
+    uint32 portChannels = 0;
+    uint8 portNum = 0;
+
+#if DioDevErrorDetect == TRUE
+    if ((Channels >> PORTx_CHANNEL_OFFSET) != 0)
+    {
+        Det_ReportError(DIO_ModuleId, 0, DIO_ApiID_ReadChannelSet, DIO_E_PARAM_INVALID_CHANNEL_ID);
+        return 0;
+    }
+#endif
+    for (portNum = 0; portNum < DIO_PORT_NUM; portNum++)
+    {
+        portChannels = (uint32)(Channels >> (portNum * 16U)) & DIO_PORT_MASK;
+        if (portChannels != 0)
         {
-            ChannelId -= 8;
-            if (GPIOC_CRH & (0x0003 << (ChannelId * 4)) == 0x00)
-            {
-                channelMode = Dio_ModeInput;
-            }
-            else
-            {
-                channelMode = Dio_ModeOutput;
-            }
+            levels |= (Dio_ChannelSetType)(DIO_GPIO(portNum)->IDR & portChannels) << (portNum * 16U);
         }
     }
-    else
+    return levels;
+}
+#endif
+
+/***************** Local Functions definition **************/
+
+#if DioDevErrorDetect == TRUE
+/**
+ * name : Dio_CheckChannelGroup
+ * param: ChannelGroupIdPtr: Pointer to ChannelGroup
+ *                    ApiId: API reporting the error
+ * Return: E_OK if the group is valid
+ * Description: pointer set, existing port, mask of adjoining channels 
+ *      within the 16 port bits, offset = position of the lowest mask bit.
+ **/
+static Std_ReturnType Dio_CheckChannelGroup(const Dio_ChannelGroupType *ChannelGroupIdPtr, uint8 ApiId)
+{
+    uint32 groupBits = 0;
+
+    if (ChannelGroupIdPtr == NULL_PTR)
     {
-        // Argument passing error
-        // shouldn't be here
+        Det_ReportError(DIO_ModuleId, 0, ApiId, DIO_E_PARAM_POINTER);
+        return E_NOT_OK;
     }
-    return channelMode;
-}
\ No newline at end of file
+    if (ChannelGroupIdPtr->port > DIO_PORTTYPE_PORTC)
+    {
+        Det_ReportError(DIO_ModuleId, 0, ApiId, DIO_E_PARAM_INVALID_PORT_ID);
+        return E_NOT_OK;
+    }
+    if (ChannelGroupIdPtr->offset > 15U)
+    {
+        Det_ReportError(DIO_ModuleId, 0, ApiId, DIO_E_PARAM_INVALID_GROUP);
+        return E_NOT_OK;
+    }
+    // Group bits moved to bit 0: must be 0b0..01..1
+    groupBits = ChannelGroupIdPtr->mask >> ChannelGroupIdPtr->offset;
+    if (ChannelGroupIdPtr->mask > 0xFFFFUL ||
+        (groupBits & 0x01UL) == 0 ||
+        (groupBits & (groupBits + 1UL)) != 0 ||
+        (groupBits << ChannelGroupIdPtr->offset) != ChannelGroupIdPtr->mask)
+    {
+        Det_ReportError(DIO_ModuleId, 0, ApiId, DIO_E_PARAM_INVALID_GROUP);
+        return E_NOT_OK;
+    }
+    return E_OK;
+}
+#endif
@@ -12,7 +12,10 @@
 
 #include "STD_TYPES.h"
 #include "BIT_MATH.h"
+#include "compiler.h"
 #include "DIO_cfg.h"
+#include "hw_reg.h"
+#include "Port.h"
 
 /******************************************************/
 /*                  Published Info                    */
@@ -86,6 +89,26 @@ typedef uint8 Dio_LevelType ;
  **/ 
 typedef uint32 Dio_PortLevelType;
 
+/**
+ * Channel / level pair of a batched write (Dio_WriteChannels)
+ **/
+typedef struct
+{
+    Dio_ChannelType ChannelId;
+    Dio_LevelType Level;
+}Dio_ChannelLevelType;
+
+/**
+ * Set of port pins, bit n = channel n (DIO_CHANNEL_A0 ~ DIO_CHANNEL_C15)
+ * Build with DIO_CHANNEL_SET(DIO_CHANNEL_xx) | DIO_CHANNEL_SET(...)
+ **/
+typedef uint64 Dio_ChannelSetType;
+
+#define DIO_CHANNEL_SET(ChannelId)      ((Dio_ChannelSetType)1U << (ChannelId))
+
+// Channel groups, DIO_lcgf.c
+extern Dio_ChannelGroupType MyDioGroupArray[Dio_GroupArraySize];
+
 /******************************************************/
 /*               Functions Definitons                 */
 /******************************************************/
@@ -110,4 +133,91 @@ void Dio_WriteChannelGroup( const Dio_ChannelGroupType* ChannelGroupIdPtr, Dio_P
     Dio_LevelType Dio_FlipChannel( Dio_ChannelType ChannelId);
 #endif
 
+/**
+ * name : Dio_IsChannelOutput
+ * param: ChannelId: DIO_CHANNEL_A0 ~ DIO_CHANNEL_C15
+ * Return: TRUE if the channel is configured as an output
+ * Description: single bit test of the Port direction shadow
+ **/
+#define Dio_IsChannelOutput(ChannelId)  PORT_PIN_IS_OUTPUT(ChannelId)
+
+#if DioBatchApi==TRUE
+    void Dio_WriteChannels( const Dio_ChannelLevelType* ChannelListPtr, uint8 Count );
+
+    void Dio_WriteChannelSet( Dio_ChannelSetType Channels, Dio_ChannelSetType Levels );
+
+    Dio_ChannelSetType Dio_ReadChannelSet( Dio_ChannelSetType Channels );
+#endif
+
+/******************************************************/
+/*            Inline channel access                   */
+/******************************************************/
+
+// Channels DIO_CHANNEL_A0 ~ DIO_CHANNEL_C15 are port pins, 16 per port
+#define DIO_PHYSICAL_CHANNELS           (48U)
+
+#define DIO_CHANNEL_ADDR(ChannelId, Offset) \
+    (GPIOA_BASE + (((uint32)(ChannelId) >> 4) * GPIO_PORT_STRIDE) + (Offset))
+
+#define DIO_CHANNEL_REG(ChannelId, Offset)  (*((volatile uint32 *)DIO_CHANNEL_ADDR((ChannelId), (Offset))))
+
+#define DIO_CHANNEL_MASK(ChannelId)     (1UL << ((uint32)(ChannelId) & 0x0FUL))
+
+// Preprocessor usable (#if): pin bit of ChannelId if it is on PortId, 0 otherwise
+#define DIO_PORT_PIN_BIT(PortId, ChannelId) \
+    ((((ChannelId) >> 4) == (PortId)) ? (1UL << ((ChannelId) & 0x0FU)) : 0UL)
+
+// Level of a port pin: IDR bit-band alias word (0 / 1) or IDR & mask
+#if DioBitBandAccess == TRUE
+#define DIO_CHANNEL_LEVEL(ChannelId) \
+    ((Dio_LevelType)(*((volatile uint32 *)BITBAND_PERIPH(DIO_CHANNEL_ADDR((ChannelId), GPIO_IDR_OFFSET), \
+                                                         ((uint32)(ChannelId) & 0x0FUL)))))
+#else
+#define DIO_CHANNEL_LEVEL(ChannelId)                                                                     \
+    ((Dio_LevelType)(((DIO_CHANNEL_REG((ChannelId), GPIO_IDR_OFFSET) & DIO_CHANNEL_MASK(ChannelId)) != 0) \
+                         ? STD_HIGH : STD_LOW))
+#endif
+
+// Compilation fails (negative array size) if ChannelId isn't a port pin
+#define DIO_ASSERT_CHANNEL(ChannelId) \
+    ((void)sizeof(char[((ChannelId) < DIO_PHYSICAL_CHANNELS) ? 1 : -1]))
+
+/**
+ * name : Dio_WriteChannelConst / Dio_ReadChannelConst
+ * param: ChannelId: compile time constant port pin (DIO_CHANNEL_xx)
+ *            Level: STD_HIGH / STD_LOW
+ * Reentrancy: Reentrant
+ * Sync
+ * Description: Single BSRR store / single IDR load, the address and mask are 
+ *      folded by the compiler. The channel is checked at compile time, no DET.
+ **/
+#define Dio_WriteChannelConst(ChannelId, Level)                                                          \
+    (DIO_ASSERT_CHANNEL(ChannelId),                                                                      \
+     (void)(DIO_CHANNEL_REG((ChannelId), GPIO_BSRR_OFFSET) =                                             \
+                (((Level) == STD_HIGH) ? DIO_CHANNEL_MASK(ChannelId) : (DIO_CHANNEL_MASK(ChannelId) << 16))))
+
+#define Dio_ReadChannelConst(ChannelId)                                                                  \
+    (DIO_ASSERT_CHANNEL(ChannelId), DIO_CHANNEL_LEVEL(ChannelId))
+
+/**
+ * name : Dio_WriteChannelFast / Dio_ReadChannelFast
+ * param: ChannelId: ID of DIO channel 
+ *            Level: STD_HIGH / STD_LOW
+ * Description: Same access as the Const variants when ChannelId is a constant port 
+ *      pin, otherwise Dio_WriteChannel / Dio_ReadChannel (DET, I/O expander).
+ **/
+#define DIO_CHANNEL_IS_CONST_PIN(ChannelId) \
+    (CONSTANT_P(ChannelId) && ((ChannelId) < DIO_PHYSICAL_CHANNELS))
+
+#define Dio_WriteChannelFast(ChannelId, Level)                                                           \
+    (DIO_CHANNEL_IS_CONST_PIN(ChannelId)                                                                 \
+         ? (void)(DIO_CHANNEL_REG((ChannelId), GPIO_BSRR_OFFSET) =                                       \
+                      (((Level) == STD_HIGH) ? DIO_CHANNEL_MASK(ChannelId) : (DIO_CHANNEL_MASK(ChannelId) << 16))) \
+         : Dio_WriteChannel((ChannelId), (Level)))
+
+#define Dio_ReadChannelFast(ChannelId)                                                                   \
+    (DIO_CHANNEL_IS_CONST_PIN(ChannelId)                                                                 \
+         ? DIO_CHANNEL_LEVEL(ChannelId)                                                                  \
+         : Dio_ReadChannel(ChannelId))
+
 #endif         // EOF
@@ -13,10 +13,50 @@
 
 #define Dio_GroupArraySize      (4U)
 
+// MyDioGroupArray indexes
+#define DIO_GROUP_SEGMENTS      (0U)
+#define DIO_GROUP_KEYPAD_ROWS   (1U)
+#define DIO_GROUP_KEYPAD_COLS   (3U)
+
+// Pins of the Hmi groups (display connector and C13 ~ C15), checked by Hmi.c
+#define DIO_GROUP_SEGMENTS_PORT         DIO_PORTTYPE_PORTB
+#define DIO_GROUP_SEGMENTS_MASK         (0xFF00U)     // B8 ~ B15
+#define DIO_GROUP_KEYPAD_ROWS_PORT      DIO_PORTTYPE_PORTA
+#define DIO_GROUP_KEYPAD_ROWS_MASK      (0x1E00U)     // A9 ~ A12
+#define DIO_GROUP_KEYPAD_COLS_PORT      DIO_PORTTYPE_PORTC
+#define DIO_GROUP_KEYPAD_COLS_MASK      (0xE000U)     // C13 ~ C15
+
 // Parent container : DioGeneral
 #define DioDevErrorDetect       TRUE
 #define DioFlipChannelApi       TRUE
 #define DioVersionInfoApi       TRUE
+// Dio_WriteChannels, Dio_WriteChannelSet, Dio_ReadChannelSet
+#define DioBatchApi             TRUE
+// Single channel read / write through the Cortex-M3 bit-band alias of IDR / ODR
+#define DioBitBandAccess        TRUE
+
+// Channels from IoExpChannelOffset are served by the SPI I/O expander (IoExp)
+#define DioIoExpanderSupport    TRUE
+
+// Parent container : DioEvent
+// Channels reported by the DIO event service (DioEvt), one bit per pin of the port
+#define DioEventRisingMaskPortA     (0x0000U)
+#define DioEventFallingMaskPortA    (0x0000U)
+#define DioEventRisingMaskPortB     (0x0008U)     // B3
+#define DioEventFallingMaskPortB    (0x0008U)     // B3
+#define DioEventRisingMaskPortC     (0x0000U)
+#define DioEventFallingMaskPortC    (0x0000U)
+
+// Parent container : DioDisplay
+/*  Display connector: B8 ~ B15 (data / segments) and A9 ~ A12 (strobes / rows)
+    are wired to one front end, the other module must not be built:
+    DIO_DISPLAY_PBUS: parallel panel (Pbus)
+    DIO_DISPLAY_HMI : 7 segment digits and keypad (Hmi)
+    B12 ~ B15 are the SPI2 pins, SPI2 is not available with either front end.
+*/
+#define DIO_DISPLAY_PBUS        (0U)
+#define DIO_DISPLAY_HMI         (1U)
+#define DioDisplayFrontEnd      DIO_DISPLAY_PBUS
 
 // Parent container : DioPort 
 #define DIO_PORTTYPE_PORTA      (0U)
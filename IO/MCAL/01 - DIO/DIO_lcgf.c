@@ -12,11 +12,14 @@
 
 #include "DIO.h"
 
+/*  Groups are adjoining channels of one port:
+    mask = the group bits, offset = position of the lowest group bit
+*/
 Dio_ChannelGroupType MyDioGroupArray[Dio_GroupArraySize] = 
 {
-    {0x0011 , 0x00  , DIO_PORTTYPE_PORTA },
-    {0x0010 , 0x02  , DIO_PORTTYPE_PORTB },
-    {0x0028 , 0x01  , DIO_PORTTYPE_PORTA },
-    {0x0005 , 0x03  , DIO_PORTTYPE_PORTC }
-}
+    {DIO_GROUP_SEGMENTS_MASK    , 0x08  , DIO_GROUP_SEGMENTS_PORT    },     // B8 ~ B15 : display segments a ~ dp
+    {DIO_GROUP_KEYPAD_ROWS_MASK , 0x09  , DIO_GROUP_KEYPAD_ROWS_PORT },     // A9 ~ A12 : keypad rows, display digits
+    {0x0018                     , 0x03  , DIO_PORTTYPE_PORTB         },     // B3 ~ B4
+    {DIO_GROUP_KEYPAD_COLS_MASK , 0x0D  , DIO_GROUP_KEYPAD_COLS_PORT }      // C13 ~ C15 : keypad columns
+};
 #endif
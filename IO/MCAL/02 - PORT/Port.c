@@ -22,6 +22,9 @@ static void PorttLocal_ActivateInternalPullUp(Port_PinType Pin);
 /************************************************************************/
 Port_ConfigType *local_PortConfigPtr = NULL_PTR;
 
+// bit n of entry x = 1: pin n of port x is an output (mode bits != input)
+uint16 Port_OutputShadow[PORT_NUM] = {0};
+
 /************************************************************************/
 /*                         APIS definitions                             */
 /************************************************************************/
@@ -254,6 +257,8 @@ void Port_RefreshPortDirection(void)
  **/
 static void PortLocal_SetPinDirection(Port_PinType Pin, Port_PinDirectionType Direction)
 {
+    Port_PinType PinId = Pin;
+
     if (Pin >= PORT_A_PIN_0 && Pin < PORT_A_PIN_8)
     {
         Pin -= PORTA_OFFSET;
@@ -288,6 +293,17 @@ static void PortLocal_SetPinDirection(Port_PinType Pin, Port_PinDirectionType Di
     else
     {
         // invalid Port pin
+        return;
+    }
+
+    // keep the direction shadow in sync with CRL/CRH
+    if ((Direction & PORT_PIN_MODE_BITS) != 0)
+    {
+        SET_BIT(Port_OutputShadow[PinId >> 4], PinId & 0x0F);
+    }
+    else
+    {
+        CLR_BIT(Port_OutputShadow[PinId >> 4], PinId & 0x0F);
     }
     return;
 }
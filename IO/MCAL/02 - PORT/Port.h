@@ -87,6 +87,19 @@ typedef struct
   PortPinConfigType PortPinsConfig[PORT_MAX_PINS_NUM];
 }Port_ConfigType;
 
+/************************************************************************/
+/*                         Direction shadow                             */
+/************************************************************************/
+
+// MODE[1:0] of Port_PinDirectionType, 00 = input
+#define PORT_PIN_MODE_BITS              (0b0011)
+
+// Output pins of each port, bit n = pin n, updated on every direction change
+extern uint16 Port_OutputShadow[PORT_NUM];
+
+// Pin: Port_PinType, TRUE if the pin is configured as an output
+#define PORT_PIN_IS_OUTPUT(Pin)         ((boolean)((Port_OutputShadow[(Pin) >> 4] >> ((Pin) & 0x0F)) & 0x01))
+
 
 /************************************************************************/
 /*                       Functions Definitons                           */
@@ -11,6 +11,7 @@
 #define PORTA_OFFSET                   ( 0U)
 #define PORTB_OFFSET                   (16U)
 #define PORTC_OFFSET                   (32U)
+#define PORT_NUM                       (3U)
 
 // Parent Conatiner: Port_PinModeType
 #define PORT_PIN_MODE_DIO               0x00
@@ -0,0 +1,283 @@
+/******************************************************/
+/* Author    : Nourhan Mansour                        */
+/* Date      : 18/10/2026                             */
+/* Version   : 1.0.0                                  */
+/* File      : Pwg.c                                  */
+/******************************************************/
+#include "hw_reg.h"
+#include "det.h"
+#include "Pwg.h"
+#include "BIT_MATH.h"
+
+/************************************************************************/
+/*                          Local constants                             */
+/************************************************************************/
+#define Pwg_ApiID_Pwg_Start 0x00
+#define Pwg_ApiID_Pwg_BuildPattern 0x01
+
+// TIM4_UP request
+#define PWG_DMA_CHANNEL (7U)
+#define PWG_TIMER TIM4_BASE
+
+/************************************************************************/
+/*                          Local functions                             */
+/************************************************************************/
+static void PwgLocal_SetSampleRate(uint32 SampleRate);
+
+/************************************************************************/
+/*                          Local variables                             */
+/************************************************************************/
+static volatile Pwg_StateType Pwg_State = PWG_IDLE;
+static Pwg_ModeType Pwg_Mode = PWG_MODE_ONE_SHOT;
+static uint16 Pwg_Length = 0;
+static Pwg_NotificationType Pwg_Notification = NULL_PTR;
+
+/************************************************************************/
+/*                         APIS definitions                             */
+/************************************************************************/
+/**
+ * @name : Pwg_Start
+ * @param PortId: port written by the pattern (DIO_PORTTYPE_PORTx)
+ * @param PatternPtr: BSRR words, one per sample (PWG_SAMPLE / Pwg_BuildPattern).
+ *                    Must stay valid while the pattern plays.
+ * @param Length: number of samples (even for PWG_MODE_DOUBLE_BUFFER)
+ * @param SampleRate: samples per second
+ * @param Mode: PWG_MODE_ONE_SHOT / PWG_MODE_LOOP / PWG_MODE_DOUBLE_BUFFER
+ * Service ID : 0x00
+ * Non Reentrant
+ * Async
+ * @Return: E_OK: started, E_NOT_OK: invalid parameters or already running
+ * Note: sample n is stored into BSRR (n + 1) / SampleRate after the start, 
+ *       the timing is set by the timer only (no interrupt latency).
+ **/
+Std_ReturnType Pwg_Start(Dio_PortType PortId, const uint32 *PatternPtr, uint16 Length,
+                         uint32 SampleRate, Pwg_ModeType Mode)
+{
+    uint32 dmaConfig = 0;
+
+#ifdef PwgDevErrorDetect
+    if (PatternPtr == NULL_PTR)
+    {
+        Det_ReportError(PWG_ModuleId, 0x00, Pwg_ApiID_Pwg_Start, PWG_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+    if (Length == 0 || (Mode == PWG_MODE_DOUBLE_BUFFER && (Length & 0x01U) != 0))
+    {
+        Det_ReportError(PWG_ModuleId, 0x00, Pwg_ApiID_Pwg_Start, PWG_E_PARAM_LENGTH);
+        return E_NOT_OK;
+    }
+    if (PortId > DIO_PORTTYPE_PORTC)
+    {
+        Det_ReportError(PWG_ModuleId, 0x00, Pwg_ApiID_Pwg_Start, PWG_E_PARAM_PORT);
+        return E_NOT_OK;
+    }
+    if (SampleRate == 0 || SampleRate > PwgMaxSampleRate)
+    {
+        Det_ReportError(PWG_ModuleId, 0x00, Pwg_ApiID_Pwg_Start, PWG_E_PARAM_RATE);
+        return E_NOT_OK;
+    }
+#endif
+    if (Pwg_State == PWG_RUNNING)
+    {
+#ifdef PwgDevErrorDetect
+        Det_ReportError(PWG_ModuleId, 0x00, Pwg_ApiID_Pwg_Start, PWG_E_BUSY);
+#endif
+        return E_NOT_OK;
+    }
+
+    Pwg_Mode = Mode;
+    Pwg_Length = Length;
+    PwgLocal_SetSampleRate(SampleRate);
+
+    // memory to peripheral, 32 bit both sides, memory increment
+    dmaConfig = (1UL << DMA_CCR_DIR) | (1UL << DMA_CCR_MINC) |
+                (2UL << DMA_CCR_PSIZE0) | (2UL << DMA_CCR_MSIZE0) |
+                ((uint32)PwgDmaPriority << DMA_CCR_PL0);
+    switch (Mode)
+    {
+    case PWG_MODE_ONE_SHOT:
+        dmaConfig |= (1UL << DMA_CCR_TCIE);
+        break;
+    case PWG_MODE_LOOP:
+        dmaConfig |= (1UL << DMA_CCR_CIRC);
+        break;
+    default: // PWG_MODE_DOUBLE_BUFFER
+        dmaConfig |= (1UL << DMA_CCR_CIRC) | (1UL << DMA_CCR_HTIE) | (1UL << DMA_CCR_TCIE);
+        break;
+    }
+
+    CLR_BIT(DMA1_CCR(PWG_DMA_CHANNEL), DMA_CCR_EN);
+    DMA1_IFCR = (0x0FUL << DMA_ISR_GIF(PWG_DMA_CHANNEL));
+    DMA1_CCR(PWG_DMA_CHANNEL) = dmaConfig;
+    DMA1_CPAR(PWG_DMA_CHANNEL) = GPIOA_BASE + ((uint32)PortId * GPIO_PORT_STRIDE) + GPIO_BSRR_OFFSET;
+    DMA1_CMAR(PWG_DMA_CHANNEL) = (uint32)PatternPtr;
+    DMA1_CNDTR(PWG_DMA_CHANNEL) = Length;
+    SET_BIT(DMA1_CCR(PWG_DMA_CHANNEL), DMA_CCR_EN);
+
+    NVIC_ISER0 = (1UL << NVIC_IRQ_DMA1_CH7);
+
+    Pwg_State = PWG_RUNNING;
+
+    // every update event requests one transfer
+    TIM_REG(PWG_TIMER, TIM_DIER_OFFSET) = (1UL << TIM_DIER_UDE);
+    SET_BIT(TIM_REG(PWG_TIMER, TIM_CR1_OFFSET), TIM_CR1_CEN);
+    return E_OK;
+}
+
+/**
+ * @name : Pwg_Stop
+ * @param void
+ * Service ID : 0x02
+ * Reentrant
+ * Sync
+ * Stops the timer and the DMA, the port keeps the last sample.
+ **/
+void Pwg_Stop(void)
+{
+    CLR_BIT(TIM_REG(PWG_TIMER, TIM_CR1_OFFSET), TIM_CR1_CEN);
+    TIM_REG(PWG_TIMER, TIM_DIER_OFFSET) = 0;
+    CLR_BIT(DMA1_CCR(PWG_DMA_CHANNEL), DMA_CCR_EN);
+    DMA1_IFCR = (0x0FUL << DMA_ISR_GIF(PWG_DMA_CHANNEL));
+    Pwg_State = PWG_IDLE;
+    return;
+}
+
+/**
+ * @name : Pwg_GetState
+ * @param void
+ * Service ID : 0x03
+ * Reentrant
+ * Sync
+ * @Return: PWG_IDLE / PWG_RUNNING
+ **/
+Pwg_StateType Pwg_GetState(void)
+{
+    return Pwg_State;
+}
+
+/**
+ * @name : Pwg_GetPosition
+ * @param void
+ * Service ID : 0x04
+ * Reentrant
+ * Sync
+ * @Return: index of the next sample to be played
+ **/
+uint16 Pwg_GetPosition(void)
+{
+    uint16 position = 0;
+
+    if (Pwg_State == PWG_RUNNING)
+    {
+        position = (uint16)(Pwg_Length - DMA1_CNDTR(PWG_DMA_CHANNEL));
+    }
+    return position;
+}
+
+/**
+ * @name : Pwg_SetNotification
+ * @param Notification: called on PWG_EVENT_xx, NULL_PTR for none
+ * Service ID : 0x05
+ * Non Reentrant
+ * Sync
+ **/
+void Pwg_SetNotification(Pwg_NotificationType Notification)
+{
+    Pwg_Notification = Notification;
+    return;
+}
+
+#ifdef PwgBuildPatternApi
+/**
+ * @name : Pwg_BuildPattern
+ * @param LevelsPtr: port level of every sample
+ * @param PatternPtr: BSRR words generated
+ * @param Length: number of samples
+ * @param Mask: pins driven by the pattern, the other pins are left untouched
+ * Service ID : 0x01
+ * Reentrant
+ * Sync
+ **/
+void Pwg_BuildPattern(const Dio_PortLevelType *LevelsPtr, uint32 *PatternPtr, uint16 Length,
+                      Dio_PortLevelType Mask)
+{
+    uint16 idx = 0;
+
+#ifdef PwgDevErrorDetect
+    if (LevelsPtr == NULL_PTR || PatternPtr == NULL_PTR)
+    {
+        Det_ReportError(PWG_ModuleId, 0x00, Pwg_ApiID_Pwg_BuildPattern, PWG_E_PARAM_POINTER);
+        return;
+    }
+#endif
+    for (idx = 0; idx < Length; idx++)
+    {
+        PatternPtr[idx] = PWG_SAMPLE(LevelsPtr[idx] & Mask, ~LevelsPtr[idx] & Mask);
+    }
+    return;
+}
+#endif
+
+/* TIM4_UP DMA channel vector */
+void DMA1_Channel7_IRQHandler(void)
+{
+    uint32 flags = DMA1_ISR;
+
+    if (GET_BIT(flags, DMA_ISR_HTIF(PWG_DMA_CHANNEL)) != 0)
+    {
+        DMA1_IFCR = (1UL << DMA_ISR_HTIF(PWG_DMA_CHANNEL));
+        if (Pwg_Notification != NULL_PTR)
+        {
+            Pwg_Notification(PWG_EVENT_FIRST_HALF);
+        }
+    }
+    if (GET_BIT(flags, DMA_ISR_TCIF(PWG_DMA_CHANNEL)) != 0)
+    {
+        DMA1_IFCR = (1UL << DMA_ISR_TCIF(PWG_DMA_CHANNEL));
+        if (Pwg_Mode == PWG_MODE_ONE_SHOT)
+        {
+            Pwg_Stop();
+            if (Pwg_Notification != NULL_PTR)
+            {
+                Pwg_Notification(PWG_EVENT_END);
+            }
+        }
+        else if (Pwg_Notification != NULL_PTR)
+        {
+            Pwg_Notification(PWG_EVENT_SECOND_HALF);
+        }
+    }
+    return;
+}
+
+/************************************************************************/
+/*                            Local Functions                           */
+/************************************************************************/
+
+/***
+ * @name : PwgLocal_SetSampleRate
+ * @param SampleRate: update events per second
+ * Sets PSC / ARR so that (PSC + 1) * (ARR + 1) = PwgTimerClockHz / SampleRate,
+ * the timer is left stopped with the values loaded.
+ **/
+static void PwgLocal_SetSampleRate(uint32 SampleRate)
+{
+    uint32 ticks = PwgTimerClockHz / SampleRate;
+    uint32 prescaler = 0;
+
+    if (ticks == 0)
+    {
+        ticks = 1;
+    }
+    prescaler = (ticks - 1UL) / 0x10000UL;
+
+    TIM_REG(PWG_TIMER, TIM_CR1_OFFSET) = (1UL << TIM_CR1_URS);
+    TIM_REG(PWG_TIMER, TIM_DIER_OFFSET) = 0;
+    TIM_REG(PWG_TIMER, TIM_PSC_OFFSET) = prescaler;
+    TIM_REG(PWG_TIMER, TIM_ARR_OFFSET) = (ticks / (prescaler + 1UL)) - 1UL;
+    TIM_REG(PWG_TIMER, TIM_CNT_OFFSET) = 0;
+    // load PSC now, URS keeps this update from requesting a DMA transfer
+    TIM_REG(PWG_TIMER, TIM_EGR_OFFSET) = (1UL << TIM_EGR_UG);
+    TIM_REG(PWG_TIMER, TIM_SR_OFFSET) = 0;
+    return;
+}
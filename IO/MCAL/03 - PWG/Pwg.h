@@ -0,0 +1,91 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : Pwg.h                                                    */
+/* Note      : Port waveform generator: TIM4 update events trigger      */
+/*             DMA1 channel 7, which copies one pattern word per sample */
+/*             into GPIOx_BSRR. No CPU work per sample.                 */
+/************************************************************************/
+#ifndef PWG_H
+#define PWG_H
+
+#include "STD_TYPES.h"
+#include "DIO.h"
+#include "Pwg_cfg.h"
+
+/************************************************************************/
+/*                          Published Info                              */
+/************************************************************************/
+
+#define PWG_ModuleId                    (205U)
+#define PWG_VendorId                    (483U)
+
+#define PWG_SW_MAJOR_VERSION            (1U)
+#define PWG_SW_MINOR_VERSION            (0U)
+#define PWG_SW_PATCH_VERSION            (0U)
+
+/************************************************************************/
+/*                                DET                                   */
+/************************************************************************/
+
+#define PWG_E_PARAM_POINTER             0x01
+#define PWG_E_PARAM_LENGTH              0x02
+#define PWG_E_PARAM_PORT                0x03
+#define PWG_E_PARAM_RATE                0x04
+#define PWG_E_BUSY                      0x06
+
+/************************************************************************/
+/*                            Type Definitons                           */
+/************************************************************************/
+
+typedef enum
+{
+  PWG_MODE_ONE_SHOT,        // pattern played once, PWG_EVENT_END at the end
+  PWG_MODE_LOOP,            // pattern repeated until Pwg_Stop, no interrupts
+  PWG_MODE_DOUBLE_BUFFER    // repeated, PWG_EVENT_xx_HALF when a half can be refilled
+}Pwg_ModeType;
+
+typedef enum
+{
+  PWG_IDLE,
+  PWG_RUNNING
+}Pwg_StateType;
+
+typedef enum
+{
+  PWG_EVENT_FIRST_HALF,     // first half played, refill it
+  PWG_EVENT_SECOND_HALF,    // second half played, refill it
+  PWG_EVENT_END             // one shot pattern finished
+}Pwg_EventType;
+
+// Called from the DMA1 channel 7 interrupt
+typedef void (*Pwg_NotificationType)(Pwg_EventType Event);
+
+/**
+ * One pattern sample: the BSRR word of the port,
+ * SetMask pins driven high, ResetMask pins driven low, others untouched.
+ **/
+#define PWG_SAMPLE(SetMask, ResetMask)  ((uint32)((SetMask) & 0xFFFFUL) | ((uint32)((ResetMask) & 0xFFFFUL) << 16))
+
+/************************************************************************/
+/*                       Functions Definitons                           */
+/************************************************************************/
+
+Std_ReturnType Pwg_Start( Dio_PortType PortId, const uint32* PatternPtr, uint16 Length,
+                          uint32 SampleRate, Pwg_ModeType Mode );
+
+void Pwg_Stop( void );
+
+Pwg_StateType Pwg_GetState( void );
+
+uint16 Pwg_GetPosition( void );
+
+void Pwg_SetNotification( Pwg_NotificationType Notification );
+
+#ifdef PwgBuildPatternApi
+  void Pwg_BuildPattern( const Dio_PortLevelType* LevelsPtr, uint32* PatternPtr, uint16 Length,
+                         Dio_PortLevelType Mask );
+#endif
+
+#endif // EOF
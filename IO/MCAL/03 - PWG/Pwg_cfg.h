@@ -0,0 +1,24 @@
+/******************************************************/
+/* Author    : Nourhan Mansour                        */
+/* Date      : 18/10/2026                             */
+/* Version   : 1.0.0                                  */
+/* File      : Pwg_cfg.h                              */
+/******************************************************/
+#ifndef PWG_CFG_H
+#define PWG_CFG_H
+
+/*** Configutration Params ***/
+#define PwgDevErrorDetect
+// Pwg_BuildPattern helper
+#define PwgBuildPatternApi
+
+// TIM4 input clock (APB1 x 2)
+#define PwgTimerClockHz                 (72000000UL)
+
+// Highest accepted sample rate, bounded by the DMA / bus latency of one BSRR store
+#define PwgMaxSampleRate                (4000000UL)
+
+// DMA1 channel 7 priority: 0 low ~ 3 very high
+#define PwgDmaPriority                  (3U)
+
+#endif
@@ -0,0 +1,594 @@
+/******************************************************/
+/* Author    : Nourhan Mansour                        */
+/* Date      : 18/10/2026                             */
+/* Version   : 1.0.0                                  */
+/* File      : Cap.c                                  */
+/******************************************************/
+#include "hw_reg.h"
+#include "det.h"
+#include "Cap.h"
+#include "BIT_MATH.h"
+
+/*
+ * DMA mode: every TIM3 period the CC1 event (CCR1 = 0) requests one
+ * transfer of the low port IDR into the raw ring. The half / complete
+ * interrupts compress the half just filled, so the compression runs
+ * once per CapRawSize / 2 samples and only costs a compare and an
+ * increment per sample. Trigger conditions are tested only when the
+ * state changes (a new entry), an unchanged state can't fire an edge
+ * and can't start matching a pattern.
+ */
+
+/************************************************************************/
+/*                          Local constants                             */
+/************************************************************************/
+#define Cap_ApiID_Cap_Start 0x00
+#define Cap_ApiID_Cap_CaptureLoop 0x01
+#define Cap_ApiID_Cap_GetEntry 0x02
+#define Cap_ApiID_Cap_ExportVcd 0x03
+
+// TIM3_CH1 request
+#define CAP_DMA_CHANNEL (6U)
+#define CAP_TIMER TIM3_BASE
+
+#define CAP_RAW_HALF (CapRawSize / 2U)
+#define CAP_MAX_RUN (0xFFFFFFFFUL)
+
+#define CAP_PORT_IDR(PortNum) \
+    (*((volatile uint32 *)(GPIOA_BASE + ((uint32)(PortNum) * GPIO_PORT_STRIDE) + GPIO_IDR_OFFSET)))
+
+/************************************************************************/
+/*                          Local functions                             */
+/************************************************************************/
+static Std_ReturnType CapLocal_Setup(const Cap_SetupType *SetupPtr, uint8 ApiId);
+static void CapLocal_SetSampleRate(uint32 SampleRate);
+static void CapLocal_CompressRaw(const uint16 *RawPtr, uint16 Count);
+LOCAL_INLINE void CapLocal_AddSample(uint32 Sample);
+static boolean CapLocal_IsTrigger(uint32 Previous, uint32 Sample);
+#ifdef CapVcdExportApi
+static void CapLocal_PutString(Cap_CharSinkType Sink, const char *StringPtr);
+static void CapLocal_PutNumber(Cap_CharSinkType Sink, uint64 Number);
+static void CapLocal_PutTime(Cap_CharSinkType Sink, uint32 Sample);
+#endif
+
+/************************************************************************/
+/*                          Local variables                             */
+/************************************************************************/
+static volatile Cap_StateType Cap_State = CAP_IDLE;
+static Cap_SetupType Cap_Setup;
+static uint32 Cap_ActiveMask = 0;
+
+// DMA landing ring
+static uint16 Cap_Raw[CapRawSize];
+
+// Compressed history, Cap_Head = newest entry
+static Cap_EntryType Cap_Ring[CapRingSize];
+static uint16 Cap_Head = 0;
+static uint16 Cap_Count = 0;
+
+// Sample indexes since the start
+static uint32 Cap_SampleCount = 0;
+static uint32 Cap_FirstSample = 0;      // first sample of the oldest entry
+static uint32 Cap_TriggerSample = 0;
+static uint32 Cap_PostRemaining = 0;
+
+/************************************************************************/
+/*                         APIS definitions                             */
+/************************************************************************/
+/**
+ * @name : Cap_Start
+ * @param SetupPtr: rate and trigger
+ * Service ID : 0x00
+ * Non Reentrant
+ * Async
+ * @Return: E_OK: sampling started (CAP_ARMED / CAP_TRIGGERED),
+ *          E_NOT_OK: invalid setup or capture running
+ * Samples the low port (CapLowPort / CapLowMask) with TIM3 + DMA1 channel 6
+ * until the post trigger samples are recorded (CAP_DONE) or Cap_Stop.
+ **/
+Std_ReturnType Cap_Start(const Cap_SetupType *SetupPtr)
+{
+    if (CapLocal_Setup(SetupPtr, Cap_ApiID_Cap_Start) != E_OK)
+    {
+        return E_NOT_OK;
+    }
+    Cap_ActiveMask = CapLowMask & 0xFFFFUL;
+
+    // peripheral (32 bit IDR) to memory (16 bit), circular over the raw ring
+    CLR_BIT(DMA1_CCR(CAP_DMA_CHANNEL), DMA_CCR_EN);
+    DMA1_IFCR = (0x0FUL << DMA_ISR_GIF(CAP_DMA_CHANNEL));
+    DMA1_CCR(CAP_DMA_CHANNEL) = (1UL << DMA_CCR_MINC) | (1UL << DMA_CCR_CIRC) |
+                                (2UL << DMA_CCR_PSIZE0) | (1UL << DMA_CCR_MSIZE0) |
+                                (1UL << DMA_CCR_HTIE) | (1UL << DMA_CCR_TCIE) |
+                                ((uint32)CapDmaPriority << DMA_CCR_PL0);
+    DMA1_CPAR(CAP_DMA_CHANNEL) = GPIOA_BASE + ((uint32)CapLowPort * GPIO_PORT_STRIDE) + GPIO_IDR_OFFSET;
+    DMA1_CMAR(CAP_DMA_CHANNEL) = (uint32)Cap_Raw;
+    DMA1_CNDTR(CAP_DMA_CHANNEL) = CapRawSize;
+    SET_BIT(DMA1_CCR(CAP_DMA_CHANNEL), DMA_CCR_EN);
+
+    NVIC_ISER0 = (1UL << NVIC_IRQ_DMA1_CH6);
+
+    // CC1 (frozen output compare, CCR1 = 0) once per period
+    TIM_REG(CAP_TIMER, TIM_CCR1_OFFSET) = 0;
+    TIM_REG(CAP_TIMER, TIM_DIER_OFFSET) = (1UL << TIM_DIER_CC1DE);
+    SET_BIT(TIM_REG(CAP_TIMER, TIM_CR1_OFFSET), TIM_CR1_CEN);
+    return E_OK;
+}
+
+/**
+ * @name : Cap_CaptureLoop
+ * @param SetupPtr: rate and trigger
+ * @param MaxSamples: samples after which the capture ends anyway
+ * Service ID : 0x01
+ * Non Reentrant
+ * Sync
+ * @Return: E_OK: capture ended (Cap_GetState tells if it completed),
+ *          E_NOT_OK: invalid setup or capture running
+ * Loop paced by the TIM3 update flag, samples both the low and the high 
+ * port. Blocks the caller; an interrupt longer than one period delays 
+ * the next sample but the rate doesn't drift.
+ **/
+Std_ReturnType Cap_CaptureLoop(const Cap_SetupType *SetupPtr, uint32 MaxSamples)
+{
+    uint32 sample = 0;
+    uint32 idx = 0;
+
+    if (CapLocal_Setup(SetupPtr, Cap_ApiID_Cap_CaptureLoop) != E_OK)
+    {
+        return E_NOT_OK;
+    }
+    Cap_ActiveMask = (CapLowMask & 0xFFFFUL) | ((CapHighMask & 0xFFFFUL) << 16);
+
+    SET_BIT(TIM_REG(CAP_TIMER, TIM_CR1_OFFSET), TIM_CR1_CEN);
+    for (idx = 0; idx < MaxSamples && Cap_State != CAP_DONE; idx++)
+    {
+        while (GET_BIT(TIM_REG(CAP_TIMER, TIM_SR_OFFSET), TIM_SR_UIF) == 0)
+        {
+            // wait for the sample time
+        }
+        TIM_REG(CAP_TIMER, TIM_SR_OFFSET) = ~(1UL << TIM_SR_UIF);
+
+        sample = CAP_PORT_IDR(CapLowPort) & CapLowMask;
+#if CapHighMask != 0
+        sample |= (CAP_PORT_IDR(CapHighPort) & CapHighMask) << 16;
+#endif
+        CapLocal_AddSample(sample);
+    }
+    CLR_BIT(TIM_REG(CAP_TIMER, TIM_CR1_OFFSET), TIM_CR1_CEN);
+    if (Cap_State != CAP_DONE)
+    {
+        Cap_State = CAP_IDLE;
+    }
+    return E_OK;
+}
+
+/**
+ * @name : Cap_Stop
+ * @param void
+ * Service ID : 0x02
+ * Reentrant
+ * Sync
+ * Stops sampling, the samples waiting in the raw ring are compressed.
+ * The history stays readable.
+ **/
+void Cap_Stop(void)
+{
+    uint32 flags = 0;
+    uint16 position = 0;
+
+    CLR_BIT(TIM_REG(CAP_TIMER, TIM_CR1_OFFSET), TIM_CR1_CEN);
+    TIM_REG(CAP_TIMER, TIM_DIER_OFFSET) = 0;
+
+    if (GET_BIT(DMA1_CCR(CAP_DMA_CHANNEL), DMA_CCR_EN) != 0)
+    {
+        // no half interrupt may run while the tail is compressed
+        NVIC_ICER0 = (1UL << NVIC_IRQ_DMA1_CH6);
+        CLR_BIT(DMA1_CCR(CAP_DMA_CHANNEL), DMA_CCR_EN);
+
+        flags = DMA1_ISR;
+        position = (uint16)(CapRawSize - DMA1_CNDTR(CAP_DMA_CHANNEL));
+        DMA1_IFCR = (0x0FUL << DMA_ISR_GIF(CAP_DMA_CHANNEL));
+
+        // halves completed but not compressed yet, in filling order, then
+        // the samples of the half being filled
+        if (position < CAP_RAW_HALF)
+        {
+            if (GET_BIT(flags, DMA_ISR_TCIF(CAP_DMA_CHANNEL)) != 0)
+            {
+                CapLocal_CompressRaw(&Cap_Raw[CAP_RAW_HALF], CAP_RAW_HALF);
+            }
+            CapLocal_CompressRaw(Cap_Raw, position);
+        }
+        else
+        {
+            if (GET_BIT(flags, DMA_ISR_HTIF(CAP_DMA_CHANNEL)) != 0)
+            {
+                CapLocal_CompressRaw(Cap_Raw, CAP_RAW_HALF);
+            }
+            CapLocal_CompressRaw(&Cap_Raw[CAP_RAW_HALF], (uint16)(position - CAP_RAW_HALF));
+        }
+    }
+    if (Cap_State != CAP_DONE)
+    {
+        Cap_State = CAP_IDLE;
+    }
+    return;
+}
+
+/**
+ * @name : Cap_GetState
+ * @param void
+ * Service ID : 0x03
+ * Reentrant
+ * Sync
+ **/
+Cap_StateType Cap_GetState(void)
+{
+    return Cap_State;
+}
+
+/**
+ * @name : Cap_GetEntryCount
+ * @param void
+ * Service ID : 0x04
+ * Reentrant
+ * Sync
+ * @Return: number of (state, run length) entries in the history
+ **/
+uint16 Cap_GetEntryCount(void)
+{
+    return Cap_Count;
+}
+
+/**
+ * @name : Cap_GetEntry
+ * @param Index: 0 = oldest entry
+ * @param EntryPtr: copy of the entry
+ * Service ID : 0x05
+ * Reentrant
+ * Sync
+ **/
+Std_ReturnType Cap_GetEntry(uint16 Index, Cap_EntryType *EntryPtr)
+{
+#ifdef CapDevErrorDetect
+    if (EntryPtr == NULL_PTR)
+    {
+        Det_ReportError(CAP_ModuleId, 0x00, Cap_ApiID_Cap_GetEntry, CAP_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+    if (Index >= Cap_Count)
+    {
+        Det_ReportError(CAP_ModuleId, 0x00, Cap_ApiID_Cap_GetEntry, CAP_E_PARAM_INDEX);
+        return E_NOT_OK;
+    }
+#endif
+    *EntryPtr = Cap_Ring[(Cap_Head + 1U + CapRingSize - Cap_Count + Index) % CapRingSize];
+    return E_OK;
+}
+
+/**
+ * @name : Cap_GetTriggerSample
+ * @param void
+ * Service ID : 0x06
+ * Reentrant
+ * Sync
+ * @Return: trigger sample, counted from the first sample of the oldest entry
+ *          (0 if the trigger itself was overwritten)
+ **/
+uint32 Cap_GetTriggerSample(void)
+{
+    return (Cap_TriggerSample > Cap_FirstSample) ? (Cap_TriggerSample - Cap_FirstSample) : 0;
+}
+
+#ifdef CapVcdExportApi
+/**
+ * @name : Cap_ExportVcd
+ * @param Sink: receives the Value Change Dump text
+ * Service ID : 0x07
+ * Non Reentrant
+ * Sync
+ * Writes the history as a VCD file (1 ns timescale, one wire per captured 
+ * channel, named after its pin), to be opened by any waveform viewer.
+ **/
+Std_ReturnType Cap_ExportVcd(Cap_CharSinkType Sink)
+{
+    Cap_EntryType entry;
+    uint32 previous = 0;
+    uint32 changed = 0;
+    uint32 sample = 0;
+    uint16 idx = 0;
+    uint8 bit = 0;
+
+#ifdef CapDevErrorDetect
+    if (Sink == NULL_PTR)
+    {
+        Det_ReportError(CAP_ModuleId, 0x00, Cap_ApiID_Cap_ExportVcd, CAP_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+#endif
+    if (Cap_State == CAP_ARMED || Cap_State == CAP_TRIGGERED || Cap_Count == 0)
+    {
+        return E_NOT_OK;
+    }
+
+    CapLocal_PutString(Sink, "$timescale 1 ns $end\n$scope module dio $end\n");
+    for (bit = 0; bit < 32U; bit++)
+    {
+        if (GET_BIT(Cap_ActiveMask, bit) != 0)
+        {
+            // $var wire 1 <id> <port letter><pin> $end
+            CapLocal_PutString(Sink, "$var wire 1 ");
+            Sink((uint8)('!' + bit));
+            Sink(' ');
+            Sink((uint8)('A' + ((bit < 16U) ? CapLowPort : CapHighPort)));
+            CapLocal_PutNumber(Sink, bit & 0x0FU);
+            CapLocal_PutString(Sink, " $end\n");
+        }
+    }
+    CapLocal_PutString(Sink, "$upscope $end\n$enddefinitions $end\n");
+
+    for (idx = 0; idx < Cap_Count; idx++)
+    {
+        (void)Cap_GetEntry(idx, &entry);
+        changed = (idx == 0) ? Cap_ActiveMask : ((entry.State ^ previous) & Cap_ActiveMask);
+        if (changed != 0)
+        {
+            CapLocal_PutTime(Sink, sample);
+            for (bit = 0; bit < 32U; bit++)
+            {
+                if (GET_BIT(changed, bit) != 0)
+                {
+                    Sink((uint8)('0' + GET_BIT(entry.State, bit)));
+                    Sink((uint8)('!' + bit));
+                    Sink('\n');
+                }
+            }
+        }
+        previous = entry.State;
+        sample += entry.RunLength;
+    }
+    // end of the last run
+    CapLocal_PutTime(Sink, sample);
+    return E_OK;
+}
+#endif
+
+/* TIM3_CH1 DMA channel vector */
+void DMA1_Channel6_IRQHandler(void)
+{
+    uint32 flags = DMA1_ISR;
+
+    if (GET_BIT(flags, DMA_ISR_HTIF(CAP_DMA_CHANNEL)) != 0)
+    {
+        DMA1_IFCR = (1UL << DMA_ISR_HTIF(CAP_DMA_CHANNEL));
+        CapLocal_CompressRaw(Cap_Raw, CAP_RAW_HALF);
+    }
+    if (GET_BIT(flags, DMA_ISR_TCIF(CAP_DMA_CHANNEL)) != 0)
+    {
+        DMA1_IFCR = (1UL << DMA_ISR_TCIF(CAP_DMA_CHANNEL));
+        CapLocal_CompressRaw(&Cap_Raw[CAP_RAW_HALF], CAP_RAW_HALF);
+    }
+    if (Cap_State == CAP_DONE)
+    {
+        CLR_BIT(TIM_REG(CAP_TIMER, TIM_CR1_OFFSET), TIM_CR1_CEN);
+        TIM_REG(CAP_TIMER, TIM_DIER_OFFSET) = 0;
+        CLR_BIT(DMA1_CCR(CAP_DMA_CHANNEL), DMA_CCR_EN);
+        DMA1_IFCR = (0x0FUL << DMA_ISR_GIF(CAP_DMA_CHANNEL));
+    }
+    return;
+}
+
+/************************************************************************/
+/*                            Local Functions                           */
+/************************************************************************/
+
+/***
+ * @name : CapLocal_Setup
+ * Checks the setup, clears the history and programs the sample rate.
+ **/
+static Std_ReturnType CapLocal_Setup(const Cap_SetupType *SetupPtr, uint8 ApiId)
+{
+#ifdef CapDevErrorDetect
+    if (SetupPtr == NULL_PTR)
+    {
+        Det_ReportError(CAP_ModuleId, 0x00, ApiId, CAP_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+    if (SetupPtr->SampleRate == 0 || SetupPtr->SampleRate > CapMaxSampleRate)
+    {
+        Det_ReportError(CAP_ModuleId, 0x00, ApiId, CAP_E_PARAM_RATE);
+        return E_NOT_OK;
+    }
+#endif
+    if (Cap_State == CAP_ARMED || Cap_State == CAP_TRIGGERED)
+    {
+#ifdef CapDevErrorDetect
+        Det_ReportError(CAP_ModuleId, 0x00, ApiId, CAP_E_BUSY);
+#endif
+        return E_NOT_OK;
+    }
+    (void)ApiId;
+
+    Cap_Setup = *SetupPtr;
+    Cap_Head = 0;
+    Cap_Count = 0;
+    Cap_SampleCount = 0;
+    Cap_FirstSample = 0;
+    Cap_TriggerSample = 0;
+    Cap_PostRemaining = (SetupPtr->PostTriggerSamples != 0) ? SetupPtr->PostTriggerSamples : 1UL;
+    Cap_State = (SetupPtr->Trigger == CAP_TRIGGER_NONE) ? CAP_TRIGGERED : CAP_ARMED;
+
+    CapLocal_SetSampleRate(SetupPtr->SampleRate);
+    return E_OK;
+}
+
+/***
+ * @name : CapLocal_SetSampleRate
+ * @param SampleRate: periods per second
+ * (PSC + 1) * (ARR + 1) = CapTimerClockHz / SampleRate, timer left stopped.
+ **/
+static void CapLocal_SetSampleRate(uint32 SampleRate)
+{
+    uint32 ticks = CapTimerClockHz / SampleRate;
+    uint32 prescaler = 0;
+
+    if (ticks == 0)
+    {
+        ticks = 1;
+    }
+    prescaler = (ticks - 1UL) / 0x10000UL;
+
+    TIM_REG(CAP_TIMER, TIM_CR1_OFFSET) = (1UL << TIM_CR1_URS);
+    TIM_REG(CAP_TIMER, TIM_DIER_OFFSET) = 0;
+    TIM_REG(CAP_TIMER, TIM_CCMR1_OFFSET) = 0;
+    TIM_REG(CAP_TIMER, TIM_PSC_OFFSET) = prescaler;
+    TIM_REG(CAP_TIMER, TIM_ARR_OFFSET) = (ticks / (prescaler + 1UL)) - 1UL;
+    TIM_REG(CAP_TIMER, TIM_CNT_OFFSET) = 0;
+    TIM_REG(CAP_TIMER, TIM_EGR_OFFSET) = (1UL << TIM_EGR_UG);
+    TIM_REG(CAP_TIMER, TIM_SR_OFFSET) = 0;
+    return;
+}
+
+/***
+ * @name : CapLocal_CompressRaw
+ * @param RawPtr: DMA samples (low port IDR)
+ * @param Count: number of samples
+ **/
+static void CapLocal_CompressRaw(const uint16 *RawPtr, uint16 Count)
+{
+    uint16 idx = 0;
+
+    for (idx = 0; idx < Count && Cap_State != CAP_DONE; idx++)
+    {
+        CapLocal_AddSample(RawPtr[idx] & Cap_ActiveMask);
+    }
+    return;
+}
+
+/***
+ * @name : CapLocal_AddSample
+ * @param Sample: masked state
+ * Extends the newest run or opens a new entry (overwriting the oldest),
+ * then runs the trigger / post trigger accounting.
+ **/
+LOCAL_INLINE void CapLocal_AddSample(uint32 Sample)
+{
+    Cap_EntryType *entryPtr = &Cap_Ring[Cap_Head];
+    uint32 previous = Sample;
+
+    if (Cap_Count != 0 && entryPtr->State == Sample && entryPtr->RunLength != CAP_MAX_RUN)
+    {
+        entryPtr->RunLength++;
+    }
+    else
+    {
+        if (Cap_Count != 0)
+        {
+            previous = entryPtr->State;
+            Cap_Head = (uint16)((Cap_Head + 1U) % CapRingSize);
+        }
+        if (Cap_Count == CapRingSize)
+        {
+            // Cap_Head now holds the oldest entry
+            Cap_FirstSample += Cap_Ring[Cap_Head].RunLength;
+        }
+        else
+        {
+            Cap_Count++;
+        }
+        Cap_Ring[Cap_Head].State = Sample;
+        Cap_Ring[Cap_Head].RunLength = 1;
+
+        if (Cap_State == CAP_ARMED && CapLocal_IsTrigger(previous, Sample) == TRUE)
+        {
+            Cap_State = CAP_TRIGGERED;
+            Cap_TriggerSample = Cap_SampleCount;
+        }
+    }
+    Cap_SampleCount++;
+
+    if (Cap_State == CAP_TRIGGERED)
+    {
+        Cap_PostRemaining--;
+        if (Cap_PostRemaining == 0)
+        {
+            Cap_State = CAP_DONE;
+        }
+    }
+    return;
+}
+
+/***
+ * @name : CapLocal_IsTrigger
+ * @param Previous: state before the change (= Sample for the first sample)
+ * @param Sample: new state
+ **/
+static boolean CapLocal_IsTrigger(uint32 Previous, uint32 Sample)
+{
+    boolean fired = FALSE;
+
+    switch (Cap_Setup.Trigger)
+    {
+    case CAP_TRIGGER_PATTERN:
+        fired = ((Sample & Cap_Setup.TriggerMask) == Cap_Setup.TriggerValue);
+        break;
+    case CAP_TRIGGER_RISING:
+        fired = ((~Previous & Sample & Cap_Setup.TriggerMask) != 0);
+        break;
+    case CAP_TRIGGER_FALLING:
+        fired = ((Previous & ~Sample & Cap_Setup.TriggerMask) != 0);
+        break;
+    case CAP_TRIGGER_ANY_EDGE:
+        fired = (((Previous ^ Sample) & Cap_Setup.TriggerMask) != 0);
+        break;
+    default:
+        fired = TRUE;
+        break;
+    }
+    return fired;
+}
+
+#ifdef CapVcdExportApi
+static void CapLocal_PutString(Cap_CharSinkType Sink, const char *StringPtr)
+{
+    while (*StringPtr != '\0')
+    {
+        Sink((uint8)*StringPtr);
+        StringPtr++;
+    }
+    return;
+}
+
+static void CapLocal_PutNumber(Cap_CharSinkType Sink, uint64 Number)
+{
+    uint8 digits[20];
+    uint8 count = 0;
+
+    do
+    {
+        digits[count] = (uint8)('0' + (Number % 10U));
+        Number /= 10U;
+        count++;
+    } while (Number != 0);
+
+    while (count != 0)
+    {
+        count--;
+        Sink(digits[count]);
+    }
+    return;
+}
+
+/***
+ * @name : CapLocal_PutTime
+ * @param Sample: sample index from the oldest entry
+ * Writes "#<time in ns>\n"
+ **/
+static void CapLocal_PutTime(Cap_CharSinkType Sink, uint32 Sample)
+{
+    Sink('#');
+    CapLocal_PutNumber(Sink, ((uint64)Sample * 1000000000ULL) / Cap_Setup.SampleRate);
+    Sink('\n');
+    return;
+}
+#endif
@@ -0,0 +1,99 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : Cap.h                                                    */
+/* Note      : Logic analyzer mode: port states sampled at a fixed rate */
+/*             (TIM3_CH1 -> DMA1 channel 6, or a timer paced loop) and  */
+/*             stored as (state, run length) entries.                   */
+/************************************************************************/
+#ifndef CAP_H
+#define CAP_H
+
+#include "STD_TYPES.h"
+#include "DIO.h"
+#include "Cap_cfg.h"
+
+/************************************************************************/
+/*                          Published Info                              */
+/************************************************************************/
+
+#define CAP_ModuleId                    (206U)
+#define CAP_VendorId                    (483U)
+
+#define CAP_SW_MAJOR_VERSION            (1U)
+#define CAP_SW_MINOR_VERSION            (0U)
+#define CAP_SW_PATCH_VERSION            (0U)
+
+/************************************************************************/
+/*                                DET                                   */
+/************************************************************************/
+
+#define CAP_E_PARAM_POINTER             0x01
+#define CAP_E_PARAM_RATE                0x04
+#define CAP_E_PARAM_INDEX               0x05
+#define CAP_E_BUSY                      0x06
+
+/************************************************************************/
+/*                            Type Definitons                           */
+/************************************************************************/
+
+typedef enum
+{
+  CAP_TRIGGER_NONE,         // recording starts immediately
+  CAP_TRIGGER_PATTERN,      // (State & TriggerMask) == TriggerValue
+  CAP_TRIGGER_RISING,       // any TriggerMask bit goes 0 -> 1
+  CAP_TRIGGER_FALLING,      // any TriggerMask bit goes 1 -> 0
+  CAP_TRIGGER_ANY_EDGE      // any TriggerMask bit changes
+}Cap_TriggerType;
+
+typedef enum
+{
+  CAP_IDLE,
+  CAP_ARMED,                // sampling, waiting for the trigger
+  CAP_TRIGGERED,            // sampling the post trigger samples
+  CAP_DONE                  // history complete, read it
+}Cap_StateType;
+
+typedef struct
+{
+  uint32 SampleRate;            // samples per second
+  Cap_TriggerType Trigger;
+  uint32 TriggerMask;           // state bits (see Cap_cfg.h)
+  uint32 TriggerValue;          // CAP_TRIGGER_PATTERN
+  uint32 PostTriggerSamples;    // samples kept after the trigger
+}Cap_SetupType;
+
+// One run of identical samples
+typedef struct
+{
+  uint32 State;
+  uint32 RunLength;             // number of samples, >= 1
+}Cap_EntryType;
+
+// Receives the VCD text one character at a time
+typedef void (*Cap_CharSinkType)(uint8 Character);
+
+/************************************************************************/
+/*                       Functions Definitons                           */
+/************************************************************************/
+
+Std_ReturnType Cap_Start( const Cap_SetupType* SetupPtr );
+
+Std_ReturnType Cap_CaptureLoop( const Cap_SetupType* SetupPtr, uint32 MaxSamples );
+
+void Cap_Stop( void );
+
+Cap_StateType Cap_GetState( void );
+
+uint16 Cap_GetEntryCount( void );
+
+Std_ReturnType Cap_GetEntry( uint16 Index, Cap_EntryType* EntryPtr );
+
+uint32 Cap_GetTriggerSample( void );
+
+#ifdef CapVcdExportApi
+  Std_ReturnType Cap_ExportVcd( Cap_CharSinkType Sink );
+#endif
+
+#endif // EOF
@@ -0,0 +1,38 @@
+/******************************************************/
+/* Author    : Nourhan Mansour                        */
+/* Date      : 18/10/2026                             */
+/* Version   : 1.0.0                                  */
+/* File      : Cap_cfg.h                              */
+/******************************************************/
+#ifndef CAP_CFG_H
+#define CAP_CFG_H
+
+#include "DIO_cfg.h"
+
+/*** Configutration Params ***/
+#define CapDevErrorDetect
+// Cap_ExportVcd
+#define CapVcdExportApi
+
+// Captured channels: port + mask. Cap_Start (DMA) samples the low port only,
+// Cap_CaptureLoop also samples the high port (mask 0: not used).
+// State bits [15:0] = low port pins, [31:16] = high port pins.
+#define CapLowPort                      DIO_PORTTYPE_PORTA
+#define CapLowMask                      (0x00FFUL)
+#define CapHighPort                     DIO_PORTTYPE_PORTB
+#define CapHighMask                     (0x0000UL)
+
+// TIM3 input clock (APB1 x 2)
+#define CapTimerClockHz                 (72000000UL)
+#define CapMaxSampleRate                (2000000UL)
+
+// DMA landing ring (samples), compressed half by half
+#define CapRawSize                      (256U)
+
+// Compressed history: (state, run length) entries, the oldest are overwritten
+#define CapRingSize                     (256U)
+
+// DMA1 channel 6 priority: 0 low ~ 3 very high
+#define CapDmaPriority                  (2U)
+
+#endif
@@ -0,0 +1,315 @@
+/******************************************************/
+/* Author    : Nourhan Mansour                        */
+/* Date      : 18/10/2026                             */
+/* Version   : 1.0.0                                  */
+/* File      : Exti.c                                 */
+/******************************************************/
+#include "hw_reg.h"
+#include "det.h"
+#include "Exti.h"
+#include "BIT_MATH.h"
+#include "compiler.h"
+
+/*
+ * A vector serves one line (EXTI0 ~ 4) or a group of lines (EXTI9_5,
+ * EXTI15_10). It takes the pending and unmasked lines of its group,
+ * clears them with one PR write (an edge arriving while the handlers
+ * run pends the line again) and calls the handler of each pending line,
+ * lowest line first, found with count trailing zeros instead of
+ * testing the lines one by one.
+ */
+
+/************************************************************************/
+/*                          Local constants                             */
+/************************************************************************/
+#define Exti_ApiID_Exti_EnableChannel 0x00
+#define Exti_ApiID_Exti_DisableChannel 0x01
+#define Exti_ApiID_Exti_GetLatency 0x02
+
+#define EXTI_LINE_NUM (16U)
+#define EXTI_LINE_FREE (0xFFU)
+
+#define EXTI_LINES_9_5 (0x03E0UL)
+#define EXTI_LINES_15_10 (0xFC00UL)
+
+/************************************************************************/
+/*                          Local functions                             */
+/************************************************************************/
+LOCAL_INLINE void ExtiLocal_Dispatch(uint32 LineMask);
+
+/************************************************************************/
+/*                          Local variables                             */
+/************************************************************************/
+// NVIC interrupt of every line
+static const uint8 Exti_LineIrq[EXTI_LINE_NUM] =
+{
+    NVIC_IRQ_EXTI0, NVIC_IRQ_EXTI1, NVIC_IRQ_EXTI2, NVIC_IRQ_EXTI3, NVIC_IRQ_EXTI4,
+    NVIC_IRQ_EXTI9_5, NVIC_IRQ_EXTI9_5, NVIC_IRQ_EXTI9_5, NVIC_IRQ_EXTI9_5, NVIC_IRQ_EXTI9_5,
+    NVIC_IRQ_EXTI15_10, NVIC_IRQ_EXTI15_10, NVIC_IRQ_EXTI15_10,
+    NVIC_IRQ_EXTI15_10, NVIC_IRQ_EXTI15_10, NVIC_IRQ_EXTI15_10
+};
+
+// Dispatch table: channel and handler of every line
+static Dio_ChannelType Exti_Channel[EXTI_LINE_NUM];
+static Exti_HandlerType Exti_Handler[EXTI_LINE_NUM];
+
+#ifdef ExtiLatencyMeasure
+static volatile Exti_LatencyType Exti_Latency;
+#endif
+
+/************************************************************************/
+/*                         APIS definitions                             */
+/************************************************************************/
+/**
+ * @name : Exti_Init
+ * Non Reentrant
+ * Sync
+ * Disables the 16 GPIO lines and, with ExtiLatencyMeasure, starts the DWT
+ * cycle counter.
+ **/
+void Exti_Init(void)
+{
+    uint8 Line = 0;
+
+    EXTI_IMR &= ~0xFFFFUL;
+    EXTI_EMR &= ~0xFFFFUL;
+    EXTI_RTSR &= ~0xFFFFUL;
+    EXTI_FTSR &= ~0xFFFFUL;
+    EXTI_PR = 0xFFFFUL;
+    for (Line = 0; Line < EXTI_LINE_NUM; Line++)
+    {
+        Exti_Channel[Line] = EXTI_LINE_FREE;
+        Exti_Handler[Line] = NULL_PTR;
+    }
+
+#ifdef ExtiLatencyMeasure
+    SET_BIT(DEMCR, DEMCR_TRCENA);
+    SET_BIT(DWT_CTRL, DWT_CTRL_CYCCNTENA);
+    Exti_ResetLatency();
+#endif
+    return;
+}
+
+/**
+ * @name : Exti_EnableChannel
+ * @param ChannelId: DIO channel, input
+ * @param Edge: EXTI_EDGE_RISING / FALLING / BOTH
+ * @param Handler: called from the interrupt on every edge
+ * Service ID : 0x00
+ * Non Reentrant
+ * Sync
+ * @Return: E_OK, E_NOT_OK: invalid parameter or the line (pin number) is
+ *          used by a channel of another port
+ **/
+Std_ReturnType Exti_EnableChannel(Dio_ChannelType ChannelId, Exti_EdgeType Edge, Exti_HandlerType Handler)
+{
+    uint8 Line = ChannelId & 0x0FU;
+    uint8 Irq = 0;
+    uint32 LineBit = (1UL << Line);
+
+#ifdef ExtiDevErrorDetect
+    if (ChannelId >= DIO_PHYSICAL_CHANNELS)
+    {
+        Det_ReportError(EXTI_ModuleId, 0, Exti_ApiID_Exti_EnableChannel, EXTI_E_PARAM_CHANNEL);
+        return E_NOT_OK;
+    }
+    if (Edge < EXTI_EDGE_RISING || Edge > EXTI_EDGE_BOTH)
+    {
+        Det_ReportError(EXTI_ModuleId, 0, Exti_ApiID_Exti_EnableChannel, EXTI_E_PARAM_EDGE);
+        return E_NOT_OK;
+    }
+    if (Handler == NULL_PTR)
+    {
+        Det_ReportError(EXTI_ModuleId, 0, Exti_ApiID_Exti_EnableChannel, EXTI_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+#endif
+    if (Exti_Channel[Line] != EXTI_LINE_FREE && Exti_Channel[Line] != ChannelId)
+    {
+#ifdef ExtiDevErrorDetect
+        Det_ReportError(EXTI_ModuleId, 0, Exti_ApiID_Exti_EnableChannel, EXTI_E_LINE_BUSY);
+#endif
+        return E_NOT_OK;
+    }
+
+    EXTI_IMR &= ~LineBit;
+
+    // route the channel port to the line
+    AFIO_EXTICR(Line >> 2) = (AFIO_EXTICR(Line >> 2) & ~(0x0FUL << ((Line & 0x03U) * 4U))) |
+                             ((uint32)(ChannelId >> 4) << ((Line & 0x03U) * 4U));
+
+    if (Edge & EXTI_EDGE_RISING)
+    {
+        EXTI_RTSR |= LineBit;
+    }
+    else
+    {
+        EXTI_RTSR &= ~LineBit;
+    }
+    if (Edge & EXTI_EDGE_FALLING)
+    {
+        EXTI_FTSR |= LineBit;
+    }
+    else
+    {
+        EXTI_FTSR &= ~LineBit;
+    }
+
+    Exti_Channel[Line] = ChannelId;
+    Exti_Handler[Line] = Handler;
+
+    EXTI_PR = LineBit;
+    EXTI_IMR |= LineBit;
+
+    Irq = Exti_LineIrq[Line];
+    if (Irq < 32U)
+    {
+        NVIC_ISER0 = (1UL << Irq);
+    }
+    else
+    {
+        NVIC_ISER1 = (1UL << (Irq - 32U));
+    }
+    return E_OK;
+}
+
+/**
+ * @name : Exti_DisableChannel
+ * @param ChannelId: DIO channel
+ * Service ID : 0x01
+ * Non Reentrant
+ * Sync
+ * Masks the line of the channel and releases it.
+ **/
+void Exti_DisableChannel(Dio_ChannelType ChannelId)
+{
+    uint8 Line = ChannelId & 0x0FU;
+    uint32 LineBit = (1UL << Line);
+
+#ifdef ExtiDevErrorDetect
+    if (ChannelId >= DIO_PHYSICAL_CHANNELS || Exti_Channel[Line] != ChannelId)
+    {
+        Det_ReportError(EXTI_ModuleId, 0, Exti_ApiID_Exti_DisableChannel, EXTI_E_PARAM_CHANNEL);
+        return;
+    }
+#endif
+    EXTI_IMR &= ~LineBit;
+    EXTI_RTSR &= ~LineBit;
+    EXTI_FTSR &= ~LineBit;
+    EXTI_PR = LineBit;
+
+    // the handler stays, a dispatch already running may still call it
+    Exti_Channel[Line] = EXTI_LINE_FREE;
+    return;
+}
+
+#ifdef ExtiLatencyMeasure
+/**
+ * @name : Exti_GetLatency
+ * @param LatencyPtr: dispatch latency since the last Exti_ResetLatency
+ * Service ID : 0x02
+ * Reentrant
+ * Sync
+ * The cycles are counted from the first instruction of the EXTI handler,
+ * the Cortex-M3 exception entry (12 cycles without wait states) comes on top.
+ **/
+void Exti_GetLatency(Exti_LatencyType *LatencyPtr)
+{
+#ifdef ExtiDevErrorDetect
+    if (LatencyPtr == NULL_PTR)
+    {
+        Det_ReportError(EXTI_ModuleId, 0, Exti_ApiID_Exti_GetLatency, EXTI_E_PARAM_POINTER);
+        return;
+    }
+#endif
+    LatencyPtr->LastCycles = Exti_Latency.LastCycles;
+    LatencyPtr->MaxCycles = Exti_Latency.MaxCycles;
+    LatencyPtr->DispatchCount = Exti_Latency.DispatchCount;
+    return;
+}
+
+/**
+ * @name : Exti_ResetLatency
+ * Non Reentrant
+ * Sync
+ **/
+void Exti_ResetLatency(void)
+{
+    Exti_Latency.LastCycles = 0;
+    Exti_Latency.MaxCycles = 0;
+    Exti_Latency.DispatchCount = 0;
+    return;
+}
+#endif
+
+/************************************************************************/
+/*                          Local functions                             */
+/************************************************************************/
+
+/**
+ * @name : ExtiLocal_Dispatch
+ * @param LineMask: lines of the vector
+ * Calls the handlers of the pending lines of LineMask.
+ **/
+LOCAL_INLINE void ExtiLocal_Dispatch(uint32 LineMask)
+{
+#ifdef ExtiLatencyMeasure
+    uint32 Entry = DWT_CYCCNT;
+    uint32 Cycles = 0;
+#endif
+    uint32 Pending = EXTI_PR & EXTI_IMR & LineMask;
+    uint8 Line = 0;
+
+    EXTI_PR = Pending;
+    while (Pending != 0)
+    {
+        Line = (uint8)CTZ(Pending);
+        Pending &= Pending - 1UL;
+#ifdef ExtiLatencyMeasure
+        Cycles = DWT_CYCCNT - Entry;
+        Exti_Latency.LastCycles = Cycles;
+        if (Cycles > Exti_Latency.MaxCycles)
+        {
+            Exti_Latency.MaxCycles = Cycles;
+        }
+        Exti_Latency.DispatchCount++;
+#endif
+        Exti_Handler[Line](Exti_Channel[Line]);
+    }
+    return;
+}
+
+void EXTI0_IRQHandler(void)
+{
+    ExtiLocal_Dispatch(1UL << 0);
+}
+
+void EXTI1_IRQHandler(void)
+{
+    ExtiLocal_Dispatch(1UL << 1);
+}
+
+void EXTI2_IRQHandler(void)
+{
+    ExtiLocal_Dispatch(1UL << 2);
+}
+
+void EXTI3_IRQHandler(void)
+{
+    ExtiLocal_Dispatch(1UL << 3);
+}
+
+void EXTI4_IRQHandler(void)
+{
+    ExtiLocal_Dispatch(1UL << 4);
+}
+
+void EXTI9_5_IRQHandler(void)
+{
+    ExtiLocal_Dispatch(EXTI_LINES_9_5);
+}
+
+void EXTI15_10_IRQHandler(void)
+{
+    ExtiLocal_Dispatch(EXTI_LINES_15_10);
+}
@@ -0,0 +1,77 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : Exti.h                                                   */
+/* Note      : Edge interrupts of DIO channels: the channel pin is      */
+/*             routed to its EXTI line (line = pin number) through      */
+/*             AFIO and the pending lines are dispatched to the         */
+/*             registered handlers from the EXTI vectors.               */
+/*             The AFIO clock has to be enabled (RCC_APB2ENR.AFIOEN).   */
+/************************************************************************/
+#ifndef EXTI_H
+#define EXTI_H
+
+#include "STD_TYPES.h"
+#include "DIO.h"
+#include "Exti_cfg.h"
+
+/************************************************************************/
+/*                          Published Info                              */
+/************************************************************************/
+
+#define EXTI_ModuleId                   (209U)
+#define EXTI_VendorId                   (483U)
+
+#define EXTI_SW_MAJOR_VERSION           (1U)
+#define EXTI_SW_MINOR_VERSION           (0U)
+#define EXTI_SW_PATCH_VERSION           (0U)
+
+/************************************************************************/
+/*                                DET                                   */
+/************************************************************************/
+
+#define EXTI_E_PARAM_POINTER            0x01
+#define EXTI_E_PARAM_CHANNEL            0x02
+#define EXTI_E_PARAM_EDGE               0x03
+#define EXTI_E_LINE_BUSY                0x04
+
+/************************************************************************/
+/*                            Type Definitons                           */
+/************************************************************************/
+
+typedef enum
+{
+  EXTI_EDGE_RISING = 1,
+  EXTI_EDGE_FALLING = 2,
+  EXTI_EDGE_BOTH = 3
+}Exti_EdgeType;
+
+// Called from the EXTI interrupt with the channel that had the edge
+typedef void (*Exti_HandlerType)(Dio_ChannelType ChannelId);
+
+// CPU cycles from the EXTI handler entry to the channel handler call
+typedef struct
+{
+  uint32 LastCycles;
+  uint32 MaxCycles;
+  uint32 DispatchCount;
+}Exti_LatencyType;
+
+/************************************************************************/
+/*                       Functions Definitons                           */
+/************************************************************************/
+
+void Exti_Init(void);
+
+Std_ReturnType Exti_EnableChannel(Dio_ChannelType ChannelId, Exti_EdgeType Edge, Exti_HandlerType Handler);
+
+void Exti_DisableChannel(Dio_ChannelType ChannelId);
+
+#ifdef ExtiLatencyMeasure
+void Exti_GetLatency(Exti_LatencyType *LatencyPtr);
+
+void Exti_ResetLatency(void);
+#endif
+
+#endif
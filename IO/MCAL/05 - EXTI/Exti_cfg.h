@@ -0,0 +1,18 @@
+/******************************************************/
+/* Author    : Nourhan Mansour                        */
+/* Date      : 18/10/2026                             */
+/* Version   : 1.0.0                                  */
+/* File      : Exti_cfg.h                             */
+/******************************************************/
+#ifndef EXTI_CFG_H
+#define EXTI_CFG_H
+
+#include "DIO_cfg.h"
+
+/*** Configutration Params ***/
+#define ExtiDevErrorDetect
+
+// DWT cycle counter timestamps in the EXTI handlers, Exti_GetLatency
+#define ExtiLatencyMeasure
+
+#endif
@@ -0,0 +1,909 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : Sd.c                                                     */
+/************************************************************************/
+
+// Multi-block jobs use CMD18 / CMD25 so a job costs one command whatever
+// its length (one CMD18 per cycle for reads longer than SdMaxBlocksPerCycle).
+// CS is never held from one Sd_MainFunction call to the next: a read
+// transaction completes within the call, and while the card is busy
+// programming CS is released between polls, so other sequences on the
+// bus never clock a selected card.
+
+#include "det.h"
+#include "BIT_MATH.h"
+#include "spi.h"
+#include "DIO.h"
+#include "Sd.h"
+
+/************************************************************************/
+/*                          Global Constants                            */
+/************************************************************************/
+#define Sd_ApiID_Sd_Init 0x00
+#define Sd_ApiID_Sd_ReadBlocks 0x01
+#define Sd_ApiID_Sd_WriteBlocks 0x02
+#define Sd_ApiID_Sd_GetJobResult 0x05
+#define Sd_ApiID_Sd_GetVersionInfo 0x10
+
+// Commands
+#define SD_CMD0_GO_IDLE_STATE 0
+#define SD_CMD8_SEND_IF_COND 8
+#define SD_CMD12_STOP_TRANSMISSION 12
+#define SD_CMD16_SET_BLOCKLEN 16
+#define SD_CMD17_READ_SINGLE_BLOCK 17
+#define SD_CMD18_READ_MULTIPLE_BLOCK 18
+#define SD_CMD24_WRITE_BLOCK 24
+#define SD_CMD25_WRITE_MULTIPLE_BLOCK 25
+#define SD_CMD55_APP_CMD 55
+#define SD_CMD58_READ_OCR 58
+#define SD_CMD59_CRC_ON_OFF 59
+#define SD_ACMD41_SD_SEND_OP_COND 41
+
+// Tokens
+#define SD_TOKEN_START_BLOCK 0xFE
+#define SD_TOKEN_START_MULTI_WRITE 0xFC
+#define SD_TOKEN_STOP_MULTI_WRITE 0xFD
+#define SD_DATA_RESPONSE_MASK 0x1F
+#define SD_DATA_RESPONSE_ACCEPTED 0x05
+
+// R1 response
+#define SD_R1_IDLE 0x01
+#define SD_R1_ILLEGAL_COMMAND 0x04
+#define SD_R1_NO_RESPONSE 0xFF
+
+// OCR bit 30 Card Capacity Status (block addressing), bit 6 of the first OCR byte
+#define SD_OCR_CCS 6
+
+// Bytes waited for a command response (NCR)
+#define SD_NCR_MAX 8U
+
+// Driver states
+#define SD_STATE_UNINIT 0x00
+#define SD_STATE_INIT_POWERUP 0x01
+#define SD_STATE_INIT_GO_IDLE 0x02
+#define SD_STATE_INIT_IF_COND 0x03
+#define SD_STATE_INIT_OP_COND 0x04
+#define SD_STATE_INIT_READ_OCR 0x05
+#define SD_STATE_INIT_CRC_ON 0x06
+#define SD_STATE_INIT_BLOCKLEN 0x07
+#define SD_STATE_IDLE 0x08
+#define SD_STATE_READ_START 0x09
+#define SD_STATE_WRITE_START 0x0A
+#define SD_STATE_WRITE_BLOCK 0x0B
+#define SD_STATE_WRITE_BUSY 0x0C
+#define SD_STATE_STOP_BUSY 0x0D
+
+/************************************************************************/
+/*                          Local functions                             */
+/************************************************************************/
+static Std_ReturnType Sd_StaticXfer(const uint8 *SrcPtr, uint8 *DestPtr, uint16 Length);
+static uint8 Sd_StaticSendCommand(uint8 Cmd, uint32 Arg);
+static void Sd_StaticSelect(void);
+static void Sd_StaticDeselect(void);
+static boolean Sd_StaticPollReady(void);
+static void Sd_StaticHandleInit(void);
+static void Sd_StaticHandleRead(void);
+static void Sd_StaticHandleWrite(void);
+static void Sd_StaticEndJob(MemIf_JobResultType Result);
+static uint8 Sd_StaticCrc7(const uint8 *DataPtr, uint8 Length);
+#if SdCrcEnable == STD_ON
+static uint16 Sd_StaticCrc16(const uint8 *DataPtr, uint16 Length);
+#endif
+
+/************************************************************************/
+/*                         Global variables                             */
+/************************************************************************/
+static const Sd_ConfigType *Sd_ConfigPtr = NULL_PTR;
+
+static MemIf_StatusType Sd_Status = MEMIF_UNINIT;
+static MemIf_JobResultType Sd_JobResult = MEMIF_JOB_OK;
+static uint8 Sd_State = SD_STATE_UNINIT;
+
+// Sequence used for the transfers, slow during card identification
+static Spi_SequenceType Sd_Seq = SdSpiSeqInit;
+
+// TRUE: SDHC/SDXC, block addressing
+static boolean Sd_BlockAddressing = FALSE;
+
+// Current job
+static Sd_BlockType Sd_JobBlock = 0;
+static uint32 Sd_JobBlocksLeft = 0;
+static const uint8 *Sd_JobSrcPtr = NULL_PTR;
+static uint8 *Sd_JobDestPtr = NULL_PTR;
+// Write job: CMD25, the read transactions are chosen per cycle
+static boolean Sd_JobMultiBlock = FALSE;
+
+// Sd_MainFunction calls spent in the current wait
+static uint16 Sd_PollCycles = 0;
+
+// Read: transactions ended without a start token since the last block received,
+// kept across the CMD12 busy wait (Sd_PollCycles is reused there)
+static uint16 Sd_TokenRetries = 0;
+
+// Command frame + response
+static uint8 Sd_CmdBuffer[6];
+static uint8 Sd_RespBuffer[4];
+static uint8 Sd_Byte = 0;
+
+#if SdCrcEnable == STD_ON
+// CRC16-CCITT (x^16 + x^12 + x^5 + 1)
+static const uint16 Sd_Crc16Table[256] =
+{
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+    0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6,
+    0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
+    0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485,
+    0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+    0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4,
+    0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
+    0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823,
+    0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
+    0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12,
+    0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+    0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41,
+    0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
+    0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70,
+    0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
+    0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F,
+    0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+    0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E,
+    0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
+    0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D,
+    0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+    0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C,
+    0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+    0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB,
+    0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
+    0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A,
+    0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
+    0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9,
+    0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+    0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8,
+    0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0
+};
+#endif
+
+/************************************************************************/
+/*                         APIS definitions                             */
+/************************************************************************/
+/**
+ * @name : Sd_Init
+ * @param: ConfigPtr: Pointer to configuration set.
+ * Non Reentrant
+ * Async
+ * Starts the card identification, Sd_GetStatus returns MEMIF_IDLE once the card is ready.
+ * Note: Spi and Dio must be initialized first.
+ **/
+void Sd_Init(const Sd_ConfigType *ConfigPtr)
+{
+#ifdef SdDevErrorDetect
+    if (ConfigPtr == NULL_PTR || ConfigPtr->SdMaxBlocksPerCycle == 0)
+    {
+        Det_ReportError(SD_ModuleId, 0, Sd_ApiID_Sd_Init, SD_E_PARAM_CONFIG);
+        return;
+    }
+    if (Sd_Status == MEMIF_BUSY)
+    {
+        Det_ReportError(SD_ModuleId, 0, Sd_ApiID_Sd_Init, SD_E_BUSY);
+        return;
+    }
+#endif
+    Sd_ConfigPtr = ConfigPtr;
+    Sd_Seq = SdSpiSeqInit;
+    Sd_BlockAddressing = FALSE;
+    Sd_PollCycles = 0;
+    Sd_JobResult = MEMIF_JOB_PENDING;
+    Sd_State = SD_STATE_INIT_POWERUP;
+    Sd_Status = MEMIF_BUSY;
+    return;
+}
+
+/**
+ * @name : Sd_ReadBlocks
+ * @param: BlockNumber: First block to read.
+ *         DataPtr: Destination, BlockCount * SD_BLOCK_SIZE bytes.
+ *         BlockCount: Number of blocks.
+ * Non Reentrant
+ * Async
+ * @Return: E_OK: read command has been accepted
+ *          E_NOT_OK: read command has not been accepted
+ **/
+Std_ReturnType Sd_ReadBlocks(Sd_BlockType BlockNumber, uint8 *DataPtr, uint32 BlockCount)
+{
+    if (Sd_Status == MEMIF_UNINIT)
+    {
+#ifdef SdDevErrorDetect
+        Det_ReportError(SD_ModuleId, 0, Sd_ApiID_Sd_ReadBlocks, SD_E_UNINIT);
+#endif
+        return E_NOT_OK;
+    }
+    if (Sd_Status == MEMIF_BUSY)
+    {
+#ifdef SdDevErrorDetect
+        Det_ReportError(SD_ModuleId, 0, Sd_ApiID_Sd_ReadBlocks, SD_E_BUSY);
+#endif
+        return E_NOT_OK;
+    }
+#ifdef SdDevErrorDetect
+    if (DataPtr == NULL_PTR)
+    {
+        Det_ReportError(SD_ModuleId, 0, Sd_ApiID_Sd_ReadBlocks, SD_E_PARAM_DATA);
+        return E_NOT_OK;
+    }
+    if (BlockCount == 0)
+    {
+        Det_ReportError(SD_ModuleId, 0, Sd_ApiID_Sd_ReadBlocks, SD_E_PARAM_LENGTH);
+        return E_NOT_OK;
+    }
+#endif
+    Sd_JobBlock = BlockNumber;
+    Sd_JobBlocksLeft = BlockCount;
+    Sd_JobDestPtr = DataPtr;
+    Sd_JobSrcPtr = NULL_PTR;
+    Sd_TokenRetries = 0;
+    Sd_JobResult = MEMIF_JOB_PENDING;
+    Sd_State = SD_STATE_READ_START;
+    Sd_Status = MEMIF_BUSY;
+    return E_OK;
+}
+
+/**
+ * @name : Sd_WriteBlocks
+ * @param: BlockNumber: First block to write.
+ *         DataPtr: Source, BlockCount * SD_BLOCK_SIZE bytes, valid until the job ends.
+ *         BlockCount: Number of blocks.
+ * Non Reentrant
+ * Async
+ * @Return: E_OK: write command has been accepted
+ *          E_NOT_OK: write command has not been accepted
+ **/
+Std_ReturnType Sd_WriteBlocks(Sd_BlockType BlockNumber, const uint8 *DataPtr, uint32 BlockCount)
+{
+    if (Sd_Status == MEMIF_UNINIT)
+    {
+#ifdef SdDevErrorDetect
+        Det_ReportError(SD_ModuleId, 0, Sd_ApiID_Sd_WriteBlocks, SD_E_UNINIT);
+#endif
+        return E_NOT_OK;
+    }
+    if (Sd_Status == MEMIF_BUSY)
+    {
+#ifdef SdDevErrorDetect
+        Det_ReportError(SD_ModuleId, 0, Sd_ApiID_Sd_WriteBlocks, SD_E_BUSY);
+#endif
+        return E_NOT_OK;
+    }
+#ifdef SdDevErrorDetect
+    if (DataPtr == NULL_PTR)
+    {
+        Det_ReportError(SD_ModuleId, 0, Sd_ApiID_Sd_WriteBlocks, SD_E_PARAM_DATA);
+        return E_NOT_OK;
+    }
+    if (BlockCount == 0)
+    {
+        Det_ReportError(SD_ModuleId, 0, Sd_ApiID_Sd_WriteBlocks, SD_E_PARAM_LENGTH);
+        return E_NOT_OK;
+    }
+#endif
+    Sd_JobBlock = BlockNumber;
+    Sd_JobBlocksLeft = BlockCount;
+    Sd_JobSrcPtr = DataPtr;
+    Sd_JobDestPtr = NULL_PTR;
+    Sd_JobMultiBlock = (BlockCount > 1) ? TRUE : FALSE;
+    Sd_JobResult = MEMIF_JOB_PENDING;
+    Sd_State = SD_STATE_WRITE_START;
+    Sd_Status = MEMIF_BUSY;
+    return E_OK;
+}
+
+/**
+ * @name : Sd_GetStatus
+ * @param: NONE
+ * Reentrant
+ * Sync
+ * @Return: MEMIF_UNINIT / MEMIF_IDLE / MEMIF_BUSY
+ **/
+MemIf_StatusType Sd_GetStatus(void)
+{
+    return Sd_Status;
+}
+
+/**
+ * @name : Sd_GetJobResult
+ * @param: NONE
+ * Reentrant
+ * Sync
+ * @Return: Result of the last job (or of the card initialization)
+ **/
+MemIf_JobResultType Sd_GetJobResult(void)
+{
+    return Sd_JobResult;
+}
+
+#if SdVersionInfoApi == TRUE
+/**
+ * @name : Sd_GetVersionInfo
+ * @param: VersionInfoPtr: Pointer to where to store the version information of this module
+ * Reentrant
+ * Sync
+ **/
+void Sd_GetVersionInfo(Std_VersionInfoType *VersionInfoPtr)
+{
+#ifdef SdDevErrorDetect
+    if (VersionInfoPtr == NULL_PTR)
+    {
+        Det_ReportError(SD_ModuleId, 0, Sd_ApiID_Sd_GetVersionInfo, SD_E_PARAM_POINTER);
+        return;
+    }
+#endif
+    VersionInfoPtr->moduleID = SD_ModuleId;
+    VersionInfoPtr->sw_major_version = SD_SW_MAJOR_VERSION;
+    VersionInfoPtr->sw_minor_version = SD_SW_MINOR_VERSION;
+    VersionInfoPtr->sw_patch_version = SD_SW_PATCH_VERSION;
+    VersionInfoPtr->vendorID = SD_VendorId;
+    return;
+}
+#endif
+
+/**
+ * @name : Sd_MainFunction
+ * @param: NONE
+ * Called cyclically by the scheduler.
+ * @Description: Performs the processing of the card initialization and of the pending job.
+ **/
+void Sd_MainFunction(void)
+{
+    switch (Sd_State)
+    {
+    case SD_STATE_INIT_POWERUP:
+    case SD_STATE_INIT_GO_IDLE:
+    case SD_STATE_INIT_IF_COND:
+    case SD_STATE_INIT_OP_COND:
+    case SD_STATE_INIT_READ_OCR:
+    case SD_STATE_INIT_CRC_ON:
+    case SD_STATE_INIT_BLOCKLEN:
+        Sd_StaticHandleInit();
+        break;
+    case SD_STATE_READ_START:
+        Sd_StaticHandleRead();
+        break;
+    case SD_STATE_WRITE_START:
+    case SD_STATE_WRITE_BLOCK:
+    case SD_STATE_WRITE_BUSY:
+    case SD_STATE_STOP_BUSY:
+        Sd_StaticHandleWrite();
+        break;
+    default:
+        // Idle / uninit
+        break;
+    }
+    return;
+}
+
+/************************************************************************/
+/*                    Local functions Definitions                       */
+/************************************************************************/
+
+/**
+* @name : Sd_StaticXfer
+* @param: SrcPtr: Data to send, NULL_PTR sends 0xFF
+*         DestPtr: Received data, NULL_PTR discards it
+*         Length: Number of bytes, split in SpiEbMaxLength transfers
+* @Description: Clocks bytes while CS is held by the driver.
+**/
+static Std_ReturnType Sd_StaticXfer(const uint8 *SrcPtr, uint8 *DestPtr, uint16 Length)
+{
+    Std_ReturnType ret = E_OK;
+    uint16 chunk = 0;
+
+    while (Length > 0 && ret == E_OK)
+    {
+        chunk = (Length < SpiEbMaxLength) ? Length : SpiEbMaxLength;
+        ret = Spi_SetupEB(SdSpiChannelData, SrcPtr, DestPtr, chunk);
+        if (ret == E_OK)
+        {
+            ret = Spi_SyncTransmit(Sd_Seq);
+        }
+        Length -= chunk;
+        if (SrcPtr != NULL_PTR)
+        {
+            SrcPtr += chunk;
+        }
+        if (DestPtr != NULL_PTR)
+        {
+            DestPtr += chunk;
+        }
+    }
+    return ret;
+}
+
+/**
+* @name : Sd_StaticSendCommand
+* @param: Cmd: Command index
+*         Arg: Command argument
+* @Return: R1 response, SD_R1_NO_RESPONSE on timeout
+* @Description: Sends one command frame, CS must be asserted.
+**/
+static uint8 Sd_StaticSendCommand(uint8 Cmd, uint32 Arg)
+{
+    uint8 idx = 0;
+
+    Sd_CmdBuffer[0] = 0x40 | Cmd;
+    Sd_CmdBuffer[1] = (uint8)(Arg >> 24);
+    Sd_CmdBuffer[2] = (uint8)(Arg >> 16);
+    Sd_CmdBuffer[3] = (uint8)(Arg >> 8);
+    Sd_CmdBuffer[4] = (uint8)(Arg);
+    Sd_CmdBuffer[5] = (uint8)((Sd_StaticCrc7(Sd_CmdBuffer, 5) << 1) | 0x01);
+
+    // One byte gap so the card releases DO before the command
+    if (Sd_StaticXfer(NULL_PTR, NULL_PTR, 1) != E_OK ||
+        Sd_StaticXfer(Sd_CmdBuffer, NULL_PTR, 6) != E_OK)
+    {
+        return SD_R1_NO_RESPONSE;
+    }
+    if (Cmd == SD_CMD12_STOP_TRANSMISSION)
+    {
+        // Stuff byte following CMD12
+        (void)Sd_StaticXfer(NULL_PTR, NULL_PTR, 1);
+    }
+
+    Sd_Byte = SD_R1_NO_RESPONSE;
+    for (idx = 0; idx < SD_NCR_MAX; idx++)
+    {
+        if (Sd_StaticXfer(NULL_PTR, &Sd_Byte, 1) != E_OK)
+        {
+            return SD_R1_NO_RESPONSE;
+        }
+        if ((Sd_Byte & 0x80) == 0)
+        {
+            break;
+        }
+    }
+    return Sd_Byte;
+}
+
+/**
+* @name : Sd_StaticSelect
+* @Description: Asserts the card chip select.
+**/
+static void Sd_StaticSelect(void)
+{
+    Dio_WriteChannelFast(SdCsChannel, STD_LOW);
+    return;
+}
+
+/**
+* @name : Sd_StaticDeselect
+* @Description: Releases the chip select; one more byte is clocked so the card releases DO.
+**/
+static void Sd_StaticDeselect(void)
+{
+    Dio_WriteChannelFast(SdCsChannel, STD_HIGH);
+    (void)Sd_StaticXfer(NULL_PTR, NULL_PTR, 1);
+    return;
+}
+
+/**
+* @name : Sd_StaticPollReady
+* @Return: TRUE: card not busy (DO high)
+* @Description: Clocks up to SdPollBytesPerCycle bytes with CS asserted,
+*               the caller releases CS if the card is still busy.
+**/
+static boolean Sd_StaticPollReady(void)
+{
+    uint8 idx = 0;
+
+    for (idx = 0; idx < SdPollBytesPerCycle; idx++)
+    {
+        if (Sd_StaticXfer(NULL_PTR, &Sd_Byte, 1) == E_OK && Sd_Byte == 0xFF)
+        {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/**
+* @name : Sd_StaticHandleInit
+* @Description: One step of the SPI mode card identification per call.
+**/
+static void Sd_StaticHandleInit(void)
+{
+    uint8 r1 = 0;
+
+    switch (Sd_State)
+    {
+    case SD_STATE_INIT_POWERUP:
+        // >= 74 clocks with CS high
+        Dio_WriteChannelFast(SdCsChannel, STD_HIGH);
+        if (Sd_StaticXfer(NULL_PTR, NULL_PTR, 10) == E_OK)
+        {
+            Sd_State = SD_STATE_INIT_GO_IDLE;
+        }
+        break;
+
+    case SD_STATE_INIT_GO_IDLE:
+        Sd_StaticSelect();
+        r1 = Sd_StaticSendCommand(SD_CMD0_GO_IDLE_STATE, 0);
+        Sd_StaticDeselect();
+        if (r1 == SD_R1_IDLE)
+        {
+            Sd_State = SD_STATE_INIT_IF_COND;
+        }
+        else if (++Sd_PollCycles > SdMaxPollCycles)
+        {
+            Sd_StaticEndJob(MEMIF_JOB_FAILED);
+        }
+        break;
+
+    case SD_STATE_INIT_IF_COND:
+        Sd_StaticSelect();
+        r1 = Sd_StaticSendCommand(SD_CMD8_SEND_IF_COND, 0x000001AAUL);
+        // R7: voltage accepted + check pattern echoed
+        (void)Sd_StaticXfer(NULL_PTR, Sd_RespBuffer, 4);
+        Sd_StaticDeselect();
+        if ((r1 & SD_R1_ILLEGAL_COMMAND) != 0)
+        {
+            // SD V1.x, byte addressing, no HCS
+            Sd_BlockAddressing = FALSE;
+        }
+        else if (r1 != SD_R1_IDLE || (Sd_RespBuffer[2] & 0x0F) != 0x01 || Sd_RespBuffer[3] != 0xAA)
+        {
+            Sd_StaticEndJob(MEMIF_JOB_FAILED);
+            break;
+        }
+        else
+        {
+            Sd_BlockAddressing = TRUE; // Resolved by CMD58
+        }
+        Sd_PollCycles = 0;
+        Sd_State = SD_STATE_INIT_OP_COND;
+        break;
+
+    case SD_STATE_INIT_OP_COND:
+        // One ACMD41 per cycle until the card leaves idle state
+        Sd_StaticSelect();
+        r1 = Sd_StaticSendCommand(SD_CMD55_APP_CMD, 0);
+        if (r1 <= SD_R1_IDLE)
+        {
+            r1 = Sd_StaticSendCommand(SD_ACMD41_SD_SEND_OP_COND, (Sd_BlockAddressing == TRUE) ? 0x40000000UL : 0);
+        }
+        Sd_StaticDeselect();
+        if (r1 == 0)
+        {
+            Sd_State = (Sd_BlockAddressing == TRUE) ? SD_STATE_INIT_READ_OCR : SD_STATE_INIT_CRC_ON;
+        }
+        else if (r1 != SD_R1_IDLE || ++Sd_PollCycles > SdMaxPollCycles)
+        {
+            Sd_StaticEndJob(MEMIF_JOB_FAILED);
+        }
+        break;
+
+    case SD_STATE_INIT_READ_OCR:
+        Sd_StaticSelect();
+        r1 = Sd_StaticSendCommand(SD_CMD58_READ_OCR, 0);
+        (void)Sd_StaticXfer(NULL_PTR, Sd_RespBuffer, 4);
+        Sd_StaticDeselect();
+        if (r1 != 0)
+        {
+            Sd_StaticEndJob(MEMIF_JOB_FAILED);
+            break;
+        }
+        Sd_BlockAddressing = (GET_BIT(Sd_RespBuffer[0], SD_OCR_CCS) != 0) ? TRUE : FALSE;
+        Sd_State = SD_STATE_INIT_CRC_ON;
+        break;
+
+    case SD_STATE_INIT_CRC_ON:
+#if SdCrcEnable == STD_ON
+        Sd_StaticSelect();
+        r1 = Sd_StaticSendCommand(SD_CMD59_CRC_ON_OFF, 1);
+        Sd_StaticDeselect();
+        if (r1 != 0)
+        {
+            Sd_StaticEndJob(MEMIF_JOB_FAILED);
+            break;
+        }
+#endif
+        Sd_State = SD_STATE_INIT_BLOCKLEN;
+        break;
+
+    case SD_STATE_INIT_BLOCKLEN:
+        if (Sd_BlockAddressing == FALSE)
+        {
+            Sd_StaticSelect();
+            r1 = Sd_StaticSendCommand(SD_CMD16_SET_BLOCKLEN, SD_BLOCK_SIZE);
+            Sd_StaticDeselect();
+            if (r1 != 0)
+            {
+                Sd_StaticEndJob(MEMIF_JOB_FAILED);
+                break;
+            }
+        }
+        // Identification done, switch to the data transfer clock
+        Sd_Seq = SdSpiSeqData;
+        Sd_StaticEndJob(MEMIF_JOB_OK);
+        break;
+
+    default:
+        break;
+    }
+    return;
+}
+
+/**
+* @name : Sd_StaticHandleRead
+* @Description: Reads up to SdMaxBlocksPerCycle blocks in one transaction
+*               (CMD17, or CMD18 ended by CMD12) and releases CS before
+*               returning. A start token that does not come within
+*               SdReadTokenPollBytes ends the transaction, it is issued
+*               again from the next block in the next cycle, up to
+*               SdMaxPollCycles times in a row before the job fails.
+**/
+static void Sd_StaticHandleRead(void)
+{
+    uint32 blocks = (Sd_JobBlocksLeft < Sd_ConfigPtr->SdMaxBlocksPerCycle) ? Sd_JobBlocksLeft : Sd_ConfigPtr->SdMaxBlocksPerCycle;
+    boolean multi = (blocks > 1) ? TRUE : FALSE;
+    MemIf_JobResultType result = MEMIF_JOB_PENDING;
+    uint16 idx = 0;
+    uint8 crc[2];
+
+    Sd_StaticSelect();
+    if (Sd_StaticSendCommand((multi == TRUE) ? SD_CMD18_READ_MULTIPLE_BLOCK : SD_CMD17_READ_SINGLE_BLOCK,
+                             (Sd_BlockAddressing == TRUE) ? Sd_JobBlock : (Sd_JobBlock * SD_BLOCK_SIZE)) != 0)
+    {
+        Sd_StaticDeselect();
+        Sd_StaticEndJob(MEMIF_JOB_FAILED);
+        return;
+    }
+
+    while (blocks > 0)
+    {
+        // Wait for the start token
+        Sd_Byte = 0xFF;
+        for (idx = 0; idx < SdReadTokenPollBytes && Sd_Byte == 0xFF; idx++)
+        {
+            (void)Sd_StaticXfer(NULL_PTR, &Sd_Byte, 1);
+        }
+        if (Sd_Byte == 0xFF)
+        {
+            if (++Sd_TokenRetries > SdMaxPollCycles)
+            {
+                result = MEMIF_JOB_FAILED;
+            }
+            break;
+        }
+        if (Sd_Byte != SD_TOKEN_START_BLOCK)
+        {
+            // Data error token
+            result = MEMIF_JOB_FAILED;
+            break;
+        }
+
+        // Block + CRC16
+        (void)Sd_StaticXfer(NULL_PTR, Sd_JobDestPtr, SD_BLOCK_SIZE);
+        (void)Sd_StaticXfer(NULL_PTR, crc, 2);
+#if SdCrcEnable == STD_ON
+        if (Sd_StaticCrc16(Sd_JobDestPtr, SD_BLOCK_SIZE) != (uint16)(((uint16)crc[0] << 8) | crc[1]))
+        {
+            result = MEMIF_BLOCK_INCONSISTENT;
+            break;
+        }
+#endif
+        Sd_JobDestPtr += SD_BLOCK_SIZE;
+        Sd_JobBlock++;
+        Sd_JobBlocksLeft--;
+        Sd_TokenRetries = 0;
+        blocks--;
+    }
+
+    if (multi == TRUE)
+    {
+        (void)Sd_StaticSendCommand(SD_CMD12_STOP_TRANSMISSION, 0);
+    }
+    Sd_StaticDeselect();
+
+    if (result != MEMIF_JOB_PENDING)
+    {
+        Sd_StaticEndJob(result);
+    }
+    else if (multi == TRUE)
+    {
+        // R1b: busy polled with CS released, the read goes on afterwards
+        Sd_PollCycles = 0;
+        Sd_State = SD_STATE_STOP_BUSY;
+    }
+    else if (Sd_JobBlocksLeft == 0)
+    {
+        Sd_StaticEndJob(MEMIF_JOB_OK);
+    }
+    else
+    {
+        // Next block / token retry next cycle, Sd_State stays SD_STATE_READ_START
+    }
+    return;
+}
+
+/**
+* @name : Sd_StaticHandleWrite
+* @Description: Issues CMD24 / CMD25 then sends one block per call; while
+*               the card is busy CS is released and polled once per call.
+**/
+static void Sd_StaticHandleWrite(void)
+{
+    uint8 token = 0;
+    uint8 crc[2] = {0xFF, 0xFF};
+#if SdCrcEnable == STD_ON
+    uint16 crc16 = 0;
+#endif
+
+    switch (Sd_State)
+    {
+    case SD_STATE_WRITE_START:
+        Sd_StaticSelect();
+        if (Sd_StaticSendCommand((Sd_JobMultiBlock == TRUE) ? SD_CMD25_WRITE_MULTIPLE_BLOCK : SD_CMD24_WRITE_BLOCK,
+                                 (Sd_BlockAddressing == TRUE) ? Sd_JobBlock : (Sd_JobBlock * SD_BLOCK_SIZE)) != 0)
+        {
+            Sd_StaticDeselect();
+            Sd_StaticEndJob(MEMIF_JOB_FAILED);
+            return;
+        }
+        Sd_State = SD_STATE_WRITE_BLOCK;
+        break;
+
+    case SD_STATE_WRITE_BUSY:
+    case SD_STATE_STOP_BUSY:
+        Sd_StaticSelect();
+        if (Sd_StaticPollReady() == FALSE)
+        {
+            Sd_StaticDeselect();
+            if (++Sd_PollCycles > SdMaxPollCycles)
+            {
+                Sd_StaticEndJob(MEMIF_JOB_FAILED);
+            }
+            return;
+        }
+        if (Sd_State == SD_STATE_STOP_BUSY && Sd_JobSrcPtr == NULL_PTR && Sd_JobBlocksLeft > 0)
+        {
+            // CMD18 transaction of a longer read ended, next one
+            Sd_StaticDeselect();
+            Sd_State = SD_STATE_READ_START;
+            return;
+        }
+        if (Sd_State == SD_STATE_STOP_BUSY || Sd_JobMultiBlock == FALSE)
+        {
+            Sd_StaticDeselect();
+            Sd_StaticEndJob(MEMIF_JOB_OK);
+            return;
+        }
+        if (Sd_JobBlocksLeft == 0)
+        {
+            // Last block programmed, end the CMD25 transaction
+            token = SD_TOKEN_STOP_MULTI_WRITE;
+            (void)Sd_StaticXfer(&token, NULL_PTR, 1);
+            Sd_StaticDeselect();
+            Sd_PollCycles = 0;
+            Sd_State = SD_STATE_STOP_BUSY;
+            return;
+        }
+        Sd_State = SD_STATE_WRITE_BLOCK;
+        break;
+
+    default:
+        break;
+    }
+
+    // SD_STATE_WRITE_BLOCK, CS asserted
+    token = (Sd_JobMultiBlock == TRUE) ? SD_TOKEN_START_MULTI_WRITE : SD_TOKEN_START_BLOCK;
+#if SdCrcEnable == STD_ON
+    crc16 = Sd_StaticCrc16(Sd_JobSrcPtr, SD_BLOCK_SIZE);
+    crc[0] = (uint8)(crc16 >> 8);
+    crc[1] = (uint8)(crc16);
+#endif
+    (void)Sd_StaticXfer(NULL_PTR, NULL_PTR, 1);
+    (void)Sd_StaticXfer(&token, NULL_PTR, 1);
+    (void)Sd_StaticXfer(Sd_JobSrcPtr, NULL_PTR, SD_BLOCK_SIZE);
+    (void)Sd_StaticXfer(crc, NULL_PTR, 2);
+    (void)Sd_StaticXfer(NULL_PTR, &Sd_Byte, 1);
+
+    if ((Sd_Byte & SD_DATA_RESPONSE_MASK) != SD_DATA_RESPONSE_ACCEPTED)
+    {
+        if (Sd_JobMultiBlock == TRUE)
+        {
+            token = SD_TOKEN_STOP_MULTI_WRITE;
+            (void)Sd_StaticXfer(&token, NULL_PTR, 1);
+        }
+        Sd_StaticDeselect();
+        Sd_StaticEndJob(MEMIF_JOB_FAILED);
+        return;
+    }
+    Sd_JobSrcPtr += SD_BLOCK_SIZE;
+    Sd_JobBlocksLeft--;
+
+    // Programming takes ms: release the bus, busy is polled next cycles
+    Sd_StaticDeselect();
+    Sd_PollCycles = 0;
+    Sd_State = SD_STATE_WRITE_BUSY;
+    return;
+}
+
+/**
+* @name : Sd_StaticEndJob
+* @param: Result: Job result
+* @Description: Releases the driver and calls the configured notification.
+**/
+static void Sd_StaticEndJob(MemIf_JobResultType Result)
+{
+    Sd_JobResult = Result;
+    if (Sd_Seq == SdSpiSeqInit)
+    {
+        // Identification failed, Sd_Init has to be called again
+        Sd_State = SD_STATE_UNINIT;
+        Sd_Status = MEMIF_UNINIT;
+    }
+    else
+    {
+        Sd_State = SD_STATE_IDLE;
+        Sd_Status = MEMIF_IDLE;
+    }
+
+    if (Result == MEMIF_JOB_OK)
+    {
+        if (Sd_ConfigPtr->SdJobEndNotification != NULL_PTR)
+        {
+            Sd_ConfigPtr->SdJobEndNotification();
+        }
+    }
+    else
+    {
+        if (Sd_ConfigPtr->SdJobErrorNotification != NULL_PTR)
+        {
+            Sd_ConfigPtr->SdJobErrorNotification();
+        }
+    }
+    return;
+}
+
+/**
+* @name : Sd_StaticCrc7
+* @Description: CRC7 (x^7 + x^3 + 1) of a command frame.
+**/
+static uint8 Sd_StaticCrc7(const uint8 *DataPtr, uint8 Length)
+{
+    uint8 crc = 0;
+    uint8 idx = 0;
+    uint8 bit = 0;
+
+    for (idx = 0; idx < Length; idx++)
+    {
+        for (bit = 0; bit < 8; bit++)
+        {
+            crc <<= 1;
+            if (((DataPtr[idx] << bit) ^ crc) & 0x80)
+            {
+                crc ^= 0x09;
+            }
+        }
+    }
+    return (uint8)(crc & 0x7F);
+}
+
+#if SdCrcEnable == STD_ON
+/**
+* @name : Sd_StaticCrc16
+* @Description: CRC16-CCITT of a data block, one table lookup per byte.
+**/
+static uint16 Sd_StaticCrc16(const uint8 *DataPtr, uint16 Length)
+{
+    uint16 crc = 0;
+    uint16 idx = 0;
+
+    for (idx = 0; idx < Length; idx++)
+    {
+        crc = (uint16)((crc << 8) ^ Sd_Crc16Table[(uint8)((crc >> 8) ^ DataPtr[idx])]);
+    }
+    return crc;
+}
+#endif
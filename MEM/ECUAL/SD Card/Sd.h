@@ -0,0 +1,81 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : Sd.h                                                     */
+/* Note      : SD / SDHC card block driver in SPI mode on top of the    */
+/*             SPI Handler. Jobs are processed by Sd_MainFunction.      */
+/************************************************************************/
+
+#ifndef SD_H
+#define SD_H
+
+#include "STD_TYPES.h"
+#include "MemIf_Types.h"
+#include "Sd_Cfg.h"
+
+/************************************************************************/
+/*                          Published Info                              */
+/************************************************************************/
+
+#define SD_ModuleId                     (200U)
+#define SD_VendorId                     (483U)
+
+#define SD_SW_MAJOR_VERSION             (1U)
+#define SD_SW_MINOR_VERSION             (0U)
+#define SD_SW_PATCH_VERSION             (0U)
+
+/************************************************************************/
+/*                                DET                                   */
+/************************************************************************/
+#define SD_E_PARAM_CONFIG               0x01
+#define SD_E_PARAM_LENGTH               0x03
+#define SD_E_PARAM_DATA                 0x04
+#define SD_E_UNINIT                     0x05
+#define SD_E_BUSY                       0x06
+#define SD_E_PARAM_POINTER              0x0A
+
+/************************************************************************/
+/*                         Module Constants                             */
+/************************************************************************/
+
+#define SD_BLOCK_SIZE                   (512U)
+
+/************************************************************************/
+/*                            Type Definitons                           */
+/************************************************************************/
+
+// Block number on the card (512 byte blocks for SDSC and SDHC)
+typedef uint32 Sd_BlockType;
+
+typedef struct
+{
+    // Called when a job (or the card initialization) has finished successfully, NULL_PTR if not used
+    void (*SdJobEndNotification)(void);
+    // Called when a job (or the card initialization) has failed, NULL_PTR if not used
+    void (*SdJobErrorNotification)(void);
+    // Blocks transferred in one call of Sd_MainFunction
+    uint8 SdMaxBlocksPerCycle;
+}Sd_ConfigType;
+
+/************************************************************************/
+/*                      Functions Declaration                           */
+/************************************************************************/
+
+void Sd_Init( const Sd_ConfigType* ConfigPtr );
+
+Std_ReturnType Sd_ReadBlocks( Sd_BlockType BlockNumber, uint8* DataPtr, uint32 BlockCount );
+
+Std_ReturnType Sd_WriteBlocks( Sd_BlockType BlockNumber, const uint8* DataPtr, uint32 BlockCount );
+
+MemIf_StatusType Sd_GetStatus( void );
+
+MemIf_JobResultType Sd_GetJobResult( void );
+
+#if SdVersionInfoApi == TRUE
+    void Sd_GetVersionInfo( Std_VersionInfoType* VersionInfoPtr );
+#endif
+
+void Sd_MainFunction( void );
+
+#endif // EOF
@@ -0,0 +1,57 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : Sd_Cfg.h                                                 */
+/************************************************************************/
+
+#ifndef SD_CFG_H
+#define SD_CFG_H
+
+#include "DIO_cfg.h"
+
+// Sd General Container
+
+// Switches the development error detection and notification on or off.
+#define SdDevErrorDetect
+
+// Switches the Sd_GetVersionInfo function ON or OFF.
+#define SdVersionInfoApi                TRUE
+
+// STD_ON: CMD59 is sent at init and the CRC16 of every data block is checked / sent
+#define SdCrcEnable                     STD_OFF
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Spi binding
+
+// EB channel, 8 bit, MSB first, default data 0xFF
+#define SdSpiChannelData                5U
+
+// Sequence holding one job [SdSpiChannelData], SPI_CS_VIA_USER, <= 400 KHz (card identification)
+#define SdSpiSeqInit                    4U
+
+// Sequence holding one job [SdSpiChannelData], SPI_CS_VIA_USER, data transfer clock
+#define SdSpiSeqData                    5U
+
+// Card chip select, driven by the Sd driver for the whole transaction
+#define SdCsChannel                     DIO_CHANNEL_A8
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Polling
+
+// Bytes clocked per Sd_MainFunction call while waiting for the end of busy
+#define SdPollBytesPerCycle             8U
+
+/*  Bytes clocked waiting for a read start token, within one Sd_MainFunction call
+    (CS is not held across calls). Has to cover the card read access time
+    (typically < 1 ms): 2048 bytes = 0.9 ms at 18 MHz. On timeout the read
+    command is issued again next cycle, SdMaxPollCycles times in a row at most.
+*/
+#define SdReadTokenPollBytes            2048U
+
+// Sd_MainFunction calls before a token / busy / ACMD41 wait is considered failed
+#define SdMaxPollCycles                 500U
+
+#endif
@@ -0,0 +1,632 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : Fls.c                                                    */
+/************************************************************************/
+
+// Every SPI access is one short Spi_SyncTransmit, the bus is released
+// between Fls_MainFunction calls so WIP polling never blocks other users.
+
+#include "det.h"
+#include "BIT_MATH.h"
+#include "spi.h"
+#include "Fls.h"
+
+/************************************************************************/
+/*                          Global Constants                            */
+/************************************************************************/
+#define Fls_ApiID_Fls_Init 0x00
+#define Fls_ApiID_Fls_Erase 0x01
+#define Fls_ApiID_Fls_Write 0x02
+#define Fls_ApiID_Fls_Cancel 0x03
+#define Fls_ApiID_Fls_GetStatus 0x04
+#define Fls_ApiID_Fls_GetJobResult 0x05
+#define Fls_ApiID_Fls_MainFunction 0x06
+#define Fls_ApiID_Fls_Read 0x07
+#define Fls_ApiID_Fls_GetVersionInfo 0x10
+
+// Opcode + 24 bit address + dummy byte
+#define FLS_CMD_MAX_LENGTH (5U)
+
+// Pending job
+#define FLS_JOB_NONE 0x00
+#define FLS_JOB_READ 0x01
+#define FLS_JOB_WRITE 0x02
+#define FLS_JOB_ERASE 0x03
+
+/************************************************************************/
+/*                          Local functions                             */
+/************************************************************************/
+static Std_ReturnType Fls_StaticSendCommand(uint8 Opcode, Fls_AddressType Address, uint8 CmdLength,
+                                            const uint8 *SrcPtr, uint8 *DestPtr, Fls_LengthType Length);
+static Std_ReturnType Fls_StaticWriteEnable(void);
+static Std_ReturnType Fls_StaticIsDeviceReady(void);
+static void Fls_StaticHandleRead(void);
+static void Fls_StaticHandleProgramErase(void);
+static void Fls_StaticRetry(void);
+static void Fls_StaticEndJob(MemIf_JobResultType Result);
+
+/************************************************************************/
+/*                         Global variables                             */
+/************************************************************************/
+static const Fls_ConfigType *Fls_ConfigPtr = NULL_PTR;
+
+static MemIf_StatusType Fls_Status = MEMIF_UNINIT;
+static MemIf_JobResultType Fls_JobResult = MEMIF_JOB_OK;
+
+// Current job
+static uint8 Fls_Job = FLS_JOB_NONE;
+static Fls_AddressType Fls_JobAddress = 0;
+static Fls_LengthType Fls_JobRemaining = 0;
+static const uint8 *Fls_JobSrcPtr = NULL_PTR;
+static uint8 *Fls_JobDestPtr = NULL_PTR;
+
+// TRUE while a program / erase command is executing inside the device
+static boolean Fls_DeviceBusy = FALSE;
+
+// Fls_MainFunction calls in a row without progress
+static uint16 Fls_PollCycles = 0;
+
+// Command channel buffer
+static uint8 Fls_CmdBuffer[FLS_CMD_MAX_LENGTH];
+
+// Status register read back
+static uint8 Fls_StatusReg = 0;
+
+/************************************************************************/
+/*                         APIS definitions                             */
+/************************************************************************/
+/**
+ * @name : Fls_Init
+ * @param: ConfigPtr: Pointer to configuration set.
+ * Service ID : 0x00
+ * Non Reentrant
+ * Sync
+ * Initializes the Flash Driver. The SPI Handler must be initialized first.
+ **/
+void Fls_Init(const Fls_ConfigType *ConfigPtr)
+{
+#ifdef FlsDevErrorDetect
+    if (ConfigPtr == NULL_PTR)
+    {
+        Det_ReportError(FLS_ModuleId, 0, Fls_ApiID_Fls_Init, FLS_E_PARAM_CONFIG);
+        return;
+    }
+    if (ConfigPtr->FlsMaxReadNormalMode == 0)
+    {
+        Det_ReportError(FLS_ModuleId, 0, Fls_ApiID_Fls_Init, FLS_E_PARAM_CONFIG);
+        return;
+    }
+    if (Fls_Status == MEMIF_BUSY)
+    {
+        Det_ReportError(FLS_ModuleId, 0, Fls_ApiID_Fls_Init, FLS_E_BUSY);
+        return;
+    }
+#endif
+    Fls_ConfigPtr = ConfigPtr;
+    Fls_Job = FLS_JOB_NONE;
+    Fls_JobResult = MEMIF_JOB_OK;
+    Fls_DeviceBusy = FALSE;
+    Fls_Status = MEMIF_IDLE;
+    return;
+}
+
+/**
+ * @name : Fls_Erase
+ * @param: TargetAddress: Sector aligned start address.
+ *         Length: Number of bytes to erase, multiple of FlsSectorSize.
+ * Service ID : 0x01
+ * Non Reentrant
+ * Async
+ * @Return: E_OK: erase command has been accepted
+ *          E_NOT_OK: erase command has not been accepted
+ * @Description: Starts an erase job, aligned 64 KB ranges use block erase.
+ **/
+Std_ReturnType Fls_Erase(Fls_AddressType TargetAddress, Fls_LengthType Length)
+{
+    if (Fls_Status == MEMIF_UNINIT)
+    {
+#ifdef FlsDevErrorDetect
+        Det_ReportError(FLS_ModuleId, 0, Fls_ApiID_Fls_Erase, FLS_E_UNINIT);
+#endif
+        return E_NOT_OK;
+    }
+    if (Fls_Status == MEMIF_BUSY)
+    {
+#ifdef FlsDevErrorDetect
+        Det_ReportError(FLS_ModuleId, 0, Fls_ApiID_Fls_Erase, FLS_E_BUSY);
+#endif
+        return E_NOT_OK;
+    }
+#ifdef FlsDevErrorDetect
+    if (TargetAddress >= FlsTotalSize || (TargetAddress % FlsSectorSize) != 0)
+    {
+        Det_ReportError(FLS_ModuleId, 0, Fls_ApiID_Fls_Erase, FLS_E_PARAM_ADDRESS);
+        return E_NOT_OK;
+    }
+    if (Length == 0 || (Length % FlsSectorSize) != 0 || Length > (FlsTotalSize - TargetAddress))
+    {
+        Det_ReportError(FLS_ModuleId, 0, Fls_ApiID_Fls_Erase, FLS_E_PARAM_LENGTH);
+        return E_NOT_OK;
+    }
+#endif
+    Fls_JobAddress = TargetAddress;
+    Fls_JobRemaining = Length;
+    Fls_JobSrcPtr = NULL_PTR;
+    Fls_JobDestPtr = NULL_PTR;
+    Fls_Job = FLS_JOB_ERASE;
+    Fls_PollCycles = 0;
+    Fls_JobResult = MEMIF_JOB_PENDING;
+    Fls_Status = MEMIF_BUSY;
+    return E_OK;
+}
+
+/**
+ * @name : Fls_Write
+ * @param: TargetAddress: Start address in flash.
+ *         SourceAddressPtr: Data to be programmed, must stay valid until the job ends.
+ *         Length: Number of bytes to program.
+ * Service ID : 0x02
+ * Non Reentrant
+ * Async
+ * @Return: E_OK: write command has been accepted
+ *          E_NOT_OK: write command has not been accepted
+ * @Description: Starts a write job, split in page program commands on page boundaries.
+ **/
+Std_ReturnType Fls_Write(Fls_AddressType TargetAddress, const uint8 *SourceAddressPtr, Fls_LengthType Length)
+{
+    if (Fls_Status == MEMIF_UNINIT)
+    {
+#ifdef FlsDevErrorDetect
+        Det_ReportError(FLS_ModuleId, 0, Fls_ApiID_Fls_Write, FLS_E_UNINIT);
+#endif
+        return E_NOT_OK;
+    }
+    if (Fls_Status == MEMIF_BUSY)
+    {
+#ifdef FlsDevErrorDetect
+        Det_ReportError(FLS_ModuleId, 0, Fls_ApiID_Fls_Write, FLS_E_BUSY);
+#endif
+        return E_NOT_OK;
+    }
+#ifdef FlsDevErrorDetect
+    if (SourceAddressPtr == NULL_PTR)
+    {
+        Det_ReportError(FLS_ModuleId, 0, Fls_ApiID_Fls_Write, FLS_E_PARAM_DATA);
+        return E_NOT_OK;
+    }
+    if (TargetAddress >= FlsTotalSize)
+    {
+        Det_ReportError(FLS_ModuleId, 0, Fls_ApiID_Fls_Write, FLS_E_PARAM_ADDRESS);
+        return E_NOT_OK;
+    }
+    if (Length == 0 || Length > (FlsTotalSize - TargetAddress))
+    {
+        Det_ReportError(FLS_ModuleId, 0, Fls_ApiID_Fls_Write, FLS_E_PARAM_LENGTH);
+        return E_NOT_OK;
+    }
+#endif
+    Fls_JobAddress = TargetAddress;
+    Fls_JobRemaining = Length;
+    Fls_JobSrcPtr = SourceAddressPtr;
+    Fls_JobDestPtr = NULL_PTR;
+    Fls_Job = FLS_JOB_WRITE;
+    Fls_PollCycles = 0;
+    Fls_JobResult = MEMIF_JOB_PENDING;
+    Fls_Status = MEMIF_BUSY;
+    return E_OK;
+}
+
+/**
+ * @name : Fls_Read
+ * @param: SourceAddress: Start address in flash.
+ *         TargetAddressPtr: Destination buffer in RAM.
+ *         Length: Number of bytes to read, any length.
+ * Service ID : 0x07
+ * Non Reentrant
+ * Async
+ * @Return: E_OK: read command has been accepted
+ *          E_NOT_OK: read command has not been accepted
+ * @Description: Starts a read job, streamed with Fast Read commands of FlsReadChunkSize bytes.
+ **/
+Std_ReturnType Fls_Read(Fls_AddressType SourceAddress, uint8 *TargetAddressPtr, Fls_LengthType Length)
+{
+    if (Fls_Status == MEMIF_UNINIT)
+    {
+#ifdef FlsDevErrorDetect
+        Det_ReportError(FLS_ModuleId, 0, Fls_ApiID_Fls_Read, FLS_E_UNINIT);
+#endif
+        return E_NOT_OK;
+    }
+    if (Fls_Status == MEMIF_BUSY)
+    {
+#ifdef FlsDevErrorDetect
+        Det_ReportError(FLS_ModuleId, 0, Fls_ApiID_Fls_Read, FLS_E_BUSY);
+#endif
+        return E_NOT_OK;
+    }
+#ifdef FlsDevErrorDetect
+    if (TargetAddressPtr == NULL_PTR)
+    {
+        Det_ReportError(FLS_ModuleId, 0, Fls_ApiID_Fls_Read, FLS_E_PARAM_DATA);
+        return E_NOT_OK;
+    }
+    if (SourceAddress >= FlsTotalSize)
+    {
+        Det_ReportError(FLS_ModuleId, 0, Fls_ApiID_Fls_Read, FLS_E_PARAM_ADDRESS);
+        return E_NOT_OK;
+    }
+    if (Length == 0 || Length > (FlsTotalSize - SourceAddress))
+    {
+        Det_ReportError(FLS_ModuleId, 0, Fls_ApiID_Fls_Read, FLS_E_PARAM_LENGTH);
+        return E_NOT_OK;
+    }
+#endif
+    Fls_JobAddress = SourceAddress;
+    Fls_JobRemaining = Length;
+    Fls_JobSrcPtr = NULL_PTR;
+    Fls_JobDestPtr = TargetAddressPtr;
+    Fls_Job = FLS_JOB_READ;
+    Fls_PollCycles = 0;
+    Fls_JobResult = MEMIF_JOB_PENDING;
+    Fls_Status = MEMIF_BUSY;
+    return E_OK;
+}
+
+#ifdef FlsCancelApi
+/**
+ * @name : Fls_Cancel
+ * @param: NONE
+ * Service ID : 0x03
+ * Non Reentrant
+ * Sync
+ * @Description: Cancels an ongoing job. A program / erase already started
+ *               in the device completes, the next job waits for it.
+ **/
+void Fls_Cancel(void)
+{
+#ifdef FlsDevErrorDetect
+    if (Fls_Status == MEMIF_UNINIT)
+    {
+        Det_ReportError(FLS_ModuleId, 0, Fls_ApiID_Fls_Cancel, FLS_E_UNINIT);
+        return;
+    }
+#endif
+    if (Fls_Status == MEMIF_BUSY)
+    {
+        Fls_StaticEndJob(MEMIF_JOB_CANCELED);
+    }
+    return;
+}
+#endif
+
+/**
+ * @name : Fls_GetStatus
+ * @param: NONE
+ * Service ID : 0x04
+ * Reentrant
+ * Sync
+ * @Return: MEMIF_UNINIT / MEMIF_IDLE / MEMIF_BUSY
+ **/
+MemIf_StatusType Fls_GetStatus(void)
+{
+    return Fls_Status;
+}
+
+/**
+ * @name : Fls_GetJobResult
+ * @param: NONE
+ * Service ID : 0x05
+ * Reentrant
+ * Sync
+ * @Return: Result of the last job
+ **/
+MemIf_JobResultType Fls_GetJobResult(void)
+{
+#ifdef FlsDevErrorDetect
+    if (Fls_Status == MEMIF_UNINIT)
+    {
+        Det_ReportError(FLS_ModuleId, 0, Fls_ApiID_Fls_GetJobResult, FLS_E_UNINIT);
+        return MEMIF_JOB_FAILED;
+    }
+#endif
+    return Fls_JobResult;
+}
+
+#if FlsVersionInfoApi == TRUE
+/**
+ * @name : Fls_GetVersionInfo
+ * @param: VersionInfoPtr: Pointer to where to store the version information of this module
+ * Service ID : 0x10
+ * Reentrant
+ * Sync
+ **/
+void Fls_GetVersionInfo(Std_VersionInfoType *VersionInfoPtr)
+{
+#ifdef FlsDevErrorDetect
+    if (VersionInfoPtr == NULL_PTR)
+    {
+        Det_ReportError(FLS_ModuleId, 0, Fls_ApiID_Fls_GetVersionInfo, FLS_E_PARAM_POINTER);
+        return;
+    }
+#endif
+    VersionInfoPtr->moduleID = FLS_ModuleId;
+    VersionInfoPtr->sw_major_version = FLS_SW_MAJOR_VERSION;
+    VersionInfoPtr->sw_minor_version = FLS_SW_MINOR_VERSION;
+    VersionInfoPtr->sw_patch_version = FLS_SW_PATCH_VERSION;
+    VersionInfoPtr->vendorID = FLS_VendorId;
+    return;
+}
+#endif
+
+/**
+ * @name : Fls_MainFunction
+ * @param: NONE
+ * Service ID : 0x06
+ * Called cyclically by the scheduler.
+ * @Description: Performs the processing of the pending job. If the bus is
+ *               taken by another sequence the step is retried next cycle.
+ **/
+void Fls_MainFunction(void)
+{
+    if (Fls_Status != MEMIF_BUSY)
+    {
+        return;
+    }
+
+    switch (Fls_Job)
+    {
+    case FLS_JOB_READ:
+        Fls_StaticHandleRead();
+        break;
+    case FLS_JOB_WRITE:
+    case FLS_JOB_ERASE:
+        Fls_StaticHandleProgramErase();
+        break;
+    default:
+        // Shouldn't be here
+        break;
+    }
+    return;
+}
+
+/************************************************************************/
+/*                    Local functions Definitions                       */
+/************************************************************************/
+
+/**
+* @name : Fls_StaticSendCommand
+* @param: Opcode: SPI NOR command
+*         Address: 24 bit address sent after the opcode
+*         CmdLength: 1 (opcode only), 4 (opcode + address) or 5 (+ dummy byte)
+*         SrcPtr / DestPtr: data phase buffers (NULL_PTR: default data / discarded)
+*         Length: data phase length, 0 for commands without data
+* @Description: Runs one command, CS is held over the command and data phase.
+**/
+static Std_ReturnType Fls_StaticSendCommand(uint8 Opcode, Fls_AddressType Address, uint8 CmdLength,
+                                            const uint8 *SrcPtr, uint8 *DestPtr, Fls_LengthType Length)
+{
+    Std_ReturnType ret = E_OK;
+
+    Fls_CmdBuffer[0] = Opcode;
+    Fls_CmdBuffer[1] = (uint8)(Address >> 16);
+    Fls_CmdBuffer[2] = (uint8)(Address >> 8);
+    Fls_CmdBuffer[3] = (uint8)(Address);
+    Fls_CmdBuffer[4] = 0xFF; // Fast Read dummy byte
+
+    ret = Spi_SetupEB(FlsSpiChannelCommand, Fls_CmdBuffer, NULL_PTR, CmdLength);
+    if (ret == E_OK)
+    {
+        if (Length == 0)
+        {
+            ret = Spi_SyncTransmit(FlsSpiSeqCommand);
+        }
+        else
+        {
+            ret = Spi_SetupEB(FlsSpiChannelData, SrcPtr, DestPtr, (Spi_NumberOfDataType)Length);
+            if (ret == E_OK)
+            {
+                ret = Spi_SyncTransmit(FlsSpiSeqTransfer);
+            }
+        }
+    }
+    return ret;
+}
+
+/**
+* @name : Fls_StaticWriteEnable
+* @Description: Sets the write enable latch before a program / erase command.
+**/
+static Std_ReturnType Fls_StaticWriteEnable(void)
+{
+    return Fls_StaticSendCommand(FLS_CMD_WRITE_ENABLE, 0, 1, NULL_PTR, NULL_PTR, 0);
+}
+
+/**
+* @name : Fls_StaticIsDeviceReady
+* @Return: E_OK: device is ready
+*          E_NOT_OK: device still busy, or the bus is taken by another sequence
+* @Description: One status register read, the caller retries next cycle.
+**/
+static Std_ReturnType Fls_StaticIsDeviceReady(void)
+{
+    Std_ReturnType ret = E_OK;
+
+    if (Fls_DeviceBusy == TRUE)
+    {
+        ret = Fls_StaticSendCommand(FLS_CMD_READ_STATUS, 0, 1, NULL_PTR, &Fls_StatusReg, 1);
+        if (ret == E_OK)
+        {
+            if (GET_BIT(Fls_StatusReg, FLS_SR_WIP) != 0)
+            {
+                ret = E_NOT_OK;
+            }
+            else
+            {
+                Fls_DeviceBusy = FALSE;
+            }
+        }
+    }
+    return ret;
+}
+
+/**
+* @name : Fls_StaticHandleRead
+* @Description: Streams up to FlsMaxReadNormalMode bytes of the read job,
+*               at least one chunk per call. A call without any chunk read
+*               counts towards FlsMaxPollCycles.
+**/
+static void Fls_StaticHandleRead(void)
+{
+    Fls_LengthType budget = Fls_ConfigPtr->FlsMaxReadNormalMode;
+    Fls_LengthType chunk = 0;
+
+    // A canceled program / erase may still be running
+    if (Fls_StaticIsDeviceReady() != E_OK)
+    {
+        Fls_StaticRetry();
+        return;
+    }
+
+    while (Fls_JobRemaining > 0)
+    {
+        chunk = (Fls_JobRemaining < FlsReadChunkSize) ? Fls_JobRemaining : FlsReadChunkSize;
+
+        if (Fls_StaticSendCommand(FLS_CMD_FAST_READ, Fls_JobAddress, 5, NULL_PTR, Fls_JobDestPtr, chunk) != E_OK)
+        {
+            // Bus taken, continue next cycle
+            if (budget == Fls_ConfigPtr->FlsMaxReadNormalMode)
+            {
+                Fls_StaticRetry();
+            }
+            return;
+        }
+        Fls_PollCycles = 0;
+        Fls_JobAddress += chunk;
+        Fls_JobDestPtr += chunk;
+        Fls_JobRemaining -= chunk;
+        if (budget <= chunk)
+        {
+            break;
+        }
+        budget -= chunk;
+    }
+
+    if (Fls_JobRemaining == 0)
+    {
+        Fls_StaticEndJob(MEMIF_JOB_OK);
+    }
+    return;
+}
+
+/**
+* @name : Fls_StaticHandleProgramErase
+* @Description: Polls WIP once per cycle; the next page / sector command is
+*               issued in the same cycle the previous one completes. A call
+*               that issues no command counts towards FlsMaxPollCycles.
+**/
+static void Fls_StaticHandleProgramErase(void)
+{
+    Fls_LengthType chunk = 0;
+    uint8 opcode = 0;
+
+    if (Fls_StaticIsDeviceReady() != E_OK)
+    {
+        Fls_StaticRetry();
+        return;
+    }
+
+    if (Fls_JobRemaining == 0)
+    {
+        Fls_StaticEndJob(MEMIF_JOB_OK);
+        return;
+    }
+
+    if (Fls_StaticWriteEnable() != E_OK)
+    {
+        Fls_StaticRetry();
+        return;
+    }
+
+    if (Fls_Job == FLS_JOB_WRITE)
+    {
+        // Never cross a page boundary, the device would wrap inside the page
+        chunk = FlsPageSize - (Fls_JobAddress % FlsPageSize);
+        if (chunk > Fls_JobRemaining)
+        {
+            chunk = Fls_JobRemaining;
+        }
+        if (Fls_StaticSendCommand(FLS_CMD_PAGE_PROGRAM, Fls_JobAddress, 4, Fls_JobSrcPtr, NULL_PTR, chunk) != E_OK)
+        {
+            Fls_StaticRetry();
+            return;
+        }
+        Fls_JobSrcPtr += chunk;
+    }
+    else
+    {
+        if ((Fls_JobAddress % FlsBlockSize) == 0 && Fls_JobRemaining >= FlsBlockSize)
+        {
+            opcode = FLS_CMD_BLOCK_ERASE;
+            chunk = FlsBlockSize;
+        }
+        else
+        {
+            opcode = FLS_CMD_SECTOR_ERASE;
+            chunk = FlsSectorSize;
+        }
+        if (Fls_StaticSendCommand(opcode, Fls_JobAddress, 4, NULL_PTR, NULL_PTR, 0) != E_OK)
+        {
+            Fls_StaticRetry();
+            return;
+        }
+    }
+    Fls_PollCycles = 0;
+    Fls_JobAddress += chunk;
+    Fls_JobRemaining -= chunk;
+    Fls_DeviceBusy = TRUE;
+    return;
+}
+
+/**
+* @name : Fls_StaticRetry
+* @Description: Counts a call without progress (device busy, bus taken), the 
+*               job fails after FlsMaxPollCycles of them in a row.
+**/
+static void Fls_StaticRetry(void)
+{
+    if (++Fls_PollCycles > FlsMaxPollCycles)
+    {
+        Fls_StaticEndJob(MEMIF_JOB_FAILED);
+    }
+    return;
+}
+
+/**
+* @name : Fls_StaticEndJob
+* @param: Result: Job result
+* @Description: Releases the driver and calls the configured notification.
+**/
+static void Fls_StaticEndJob(MemIf_JobResultType Result)
+{
+    Fls_Job = FLS_JOB_NONE;
+    Fls_JobResult = Result;
+    Fls_Status = MEMIF_IDLE;
+
+    if (Result == MEMIF_JOB_OK)
+    {
+        if (Fls_ConfigPtr->FlsJobEndNotification != NULL_PTR)
+        {
+            Fls_ConfigPtr->FlsJobEndNotification();
+        }
+    }
+    else
+    {
+        if (Fls_ConfigPtr->FlsJobErrorNotification != NULL_PTR)
+        {
+            Fls_ConfigPtr->FlsJobErrorNotification();
+        }
+    }
+    return;
+}
@@ -0,0 +1,104 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : Fls.h                                                    */
+/* Note      : External SPI NOR flash driver on top of the SPI Handler. */
+/*             Jobs are processed asynchronously by Fls_MainFunction.   */
+/************************************************************************/
+
+#ifndef FLS_H
+#define FLS_H
+
+#include "STD_TYPES.h"
+#include "MemIf_Types.h"
+#include "Fls_Cfg.h"
+
+/************************************************************************/
+/*                          Published Info                              */
+/************************************************************************/
+
+#define FLS_ModuleId                    (92U)
+#define FLS_VendorId                    (483U)
+
+#define FLS_AR_RELEASE_MAJOR_VERSION    (1U)
+#define FLS_AR_RELEASE_MINOR_VERSION    (0U)
+#define FLS_AR_RELEASE_REVISION_VERSION (0U)
+
+#define FLS_SW_MAJOR_VERSION            (4U)
+#define FLS_SW_MINOR_VERSION            (3U)
+#define FLS_SW_PATCH_VERSION            (1U)
+
+/************************************************************************/
+/*                                DET                                   */
+/************************************************************************/
+#define FLS_E_PARAM_CONFIG              0x01
+#define FLS_E_PARAM_ADDRESS             0x02
+#define FLS_E_PARAM_LENGTH              0x03
+#define FLS_E_PARAM_DATA                0x04
+#define FLS_E_UNINIT                    0x05
+#define FLS_E_BUSY                      0x06
+#define FLS_E_PARAM_POINTER             0x0A
+
+/************************************************************************/
+/*                         Module Constants                             */
+/************************************************************************/
+
+// SPI NOR command set
+#define FLS_CMD_WRITE_ENABLE            0x06
+#define FLS_CMD_READ_STATUS             0x05
+#define FLS_CMD_FAST_READ               0x0B
+#define FLS_CMD_PAGE_PROGRAM            0x02
+#define FLS_CMD_SECTOR_ERASE            0x20
+#define FLS_CMD_BLOCK_ERASE             0xD8
+
+// Status register: Write In Progress
+#define FLS_SR_WIP                      0
+
+/************************************************************************/
+/*                            Type Definitons                           */
+/************************************************************************/
+
+// Address offset in the flash device
+typedef uint32 Fls_AddressType;
+
+// Number of bytes to read, write, erase
+typedef uint32 Fls_LengthType;
+
+typedef struct
+{
+    // Called when a job has finished successfully, NULL_PTR if not used
+    void (*FlsJobEndNotification)(void);
+    // Called when a job has failed or was canceled, NULL_PTR if not used
+    void (*FlsJobErrorNotification)(void);
+    // Bytes read in one call of Fls_MainFunction, > 0
+    Fls_LengthType FlsMaxReadNormalMode;
+}Fls_ConfigType;
+
+/************************************************************************/
+/*                      Functions Declaration                           */
+/************************************************************************/
+
+void Fls_Init( const Fls_ConfigType* ConfigPtr );
+
+Std_ReturnType Fls_Erase( Fls_AddressType TargetAddress, Fls_LengthType Length );
+
+Std_ReturnType Fls_Write( Fls_AddressType TargetAddress, const uint8* SourceAddressPtr, Fls_LengthType Length );
+
+Std_ReturnType Fls_Read( Fls_AddressType SourceAddress, uint8* TargetAddressPtr, Fls_LengthType Length );
+
+#ifdef FlsCancelApi
+    void Fls_Cancel( void );
+#endif
+
+MemIf_StatusType Fls_GetStatus( void );
+
+MemIf_JobResultType Fls_GetJobResult( void );
+
+#if FlsVersionInfoApi == TRUE
+    void Fls_GetVersionInfo( Std_VersionInfoType* VersionInfoPtr );
+#endif
+
+void Fls_MainFunction( void );
+
+#endif // EOF
@@ -0,0 +1,67 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : Fls_Cfg.h                                                */
+/************************************************************************/
+
+#ifndef FLS_CFG_H
+#define FLS_CFG_H
+
+#include "spi_Cfg.h"
+
+// Fls General Container
+
+// Switches the development error detection and notification on or off.
+#define FlsDevErrorDetect
+
+// Switches the Fls_Cancel function ON or OFF.
+#define FlsCancelApi
+
+// Switches the Fls_GetVersionInfo function ON or OFF.
+#define FlsVersionInfoApi               TRUE
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Fls Published Information (SPI NOR device, default: W25Q16)
+
+// Page program granularity, a program command never crosses a page boundary
+#define FlsPageSize                     (256UL)
+
+// Smallest erasable unit (sector erase 0x20)
+#define FlsSectorSize                   (4096UL)
+
+// Block erase unit (0xD8), used instead of sectors for aligned ranges
+#define FlsBlockSize                    (65536UL)
+
+// Total device size in bytes
+#define FlsTotalSize                    (0x200000UL)
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Spi binding, the jobs must use the flash chip select pin
+
+// EB channel, 8 bit, MSB first: opcode + 24 bit address (+ dummy byte)
+#define FlsSpiChannelCommand            3U
+
+// EB channel, 8 bit, MSB first, default data 0xFF: data phase
+#define FlsSpiChannelData               4U
+
+// Sequence holding one job with channels [FlsSpiChannelCommand]
+#define FlsSpiSeqCommand                2U
+
+// Sequence holding one job with channels [FlsSpiChannelCommand, FlsSpiChannelData]
+#define FlsSpiSeqTransfer               3U
+
+// Data bytes clocked by one Fast Read / Page Program command
+// Range: 1 ~ SpiEbMaxLength
+#define FlsReadChunkSize                SpiEbMaxLength
+
+/*  Fls_MainFunction calls in a row without progress (WIP still set, or the bus
+    taken by another sequence) before the job ends with MEMIF_JOB_FAILED.
+    Has to cover the longest device operation: block erase, 2 s max on the
+    W25Q16 = 2000 calls at a 1 ms period.
+*/
+#define FlsMaxPollCycles                4000U
+
+#endif
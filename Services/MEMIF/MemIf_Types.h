@@ -0,0 +1,45 @@
+/************************************************************************/
+/* Author    : Nourhan Mansour                                          */
+/* Date      : 18/10/2026                                               */
+/* Version   : 1.0.0                                                    */
+/* File      : MemIf_Types.h                                            */
+/************************************************************************/
+
+#ifndef MEMIF_TYPES_H
+#define MEMIF_TYPES_H
+
+#include "STD_TYPES.h"
+
+/*
+Denotes the current status of the underlying abstraction module and device drive.
+MEMIF_UNINIT            The underlying abstraction module or device driver has not been initialized (yet).
+MEMIF_IDLE              The underlying abstraction module or device driver is currently idle.
+MEMIF_BUSY              The underlying abstraction module or device driver is currently busy.
+MEMIF_BUSY_INTERNAL     The underlying abstraction module is busy with internal management operations.
+*/
+typedef uint8 MemIf_StatusType;
+
+#define MEMIF_UNINIT                (0x00U)
+#define MEMIF_IDLE                  (0x01U)
+#define MEMIF_BUSY                  (0x02U)
+#define MEMIF_BUSY_INTERNAL         (0x03U)
+
+/*
+Denotes the result of the last job.
+MEMIF_JOB_OK                The job has been finished successfully.
+MEMIF_JOB_FAILED            The job has not been finished successfully.
+MEMIF_JOB_PENDING           The job has not yet been finished.
+MEMIF_JOB_CANCELED          The job has been canceled.
+MEMIF_BLOCK_INCONSISTENT    The requested block is inconsistent, it may contain corrupted data.
+MEMIF_BLOCK_INVALID         The requested block has been marked as invalid.
+*/
+typedef uint8 MemIf_JobResultType;
+
+#define MEMIF_JOB_OK                (0x00U)
+#define MEMIF_JOB_FAILED            (0x01U)
+#define MEMIF_JOB_PENDING           (0x02U)
+#define MEMIF_JOB_CANCELED          (0x03U)
+#define MEMIF_BLOCK_INCONSISTENT    (0x04U)
+#define MEMIF_BLOCK_INVALID         (0x05U)
+
+#endif